@@ -224,6 +224,7 @@
 #include <GLFW/glfw3.h>
 
 #include "src/Animation.h"
+#include "src/BoundingBox.h"
 #include "src/BumpMapCore.h"
 #include "src/Camera.h"
 #include "src/CameraController.h"
@@ -232,15 +233,23 @@
 #include "src/Controller.h"
 #include "src/Core.h"
 #include "src/CubeMapCore.h"
+#include "src/DrawBatcher.h"
+#include "src/GearCore.h"
+#include "src/GearProfile.h"
+#include "src/GeometryArena.h"
 #include "src/GeometryCore.h"
 #include "src/GeometryCoreFactory.h"
+#include "src/GeometryCoreFuture.h"
 #include "src/Group.h"
 #include "src/InfoTraverser.h"
+#include "src/InstancedShape.h"
 #include "src/KeyboardController.h"
 #include "src/Leaf.h"
 #include "src/Light.h"
 #include "src/LightPosition.h"
+#include "src/MappedFile.h"
 #include "src/MaterialCore.h"
+#include "src/MeshProcessor.h"
 #include "src/MouseController.h"
 #include "src/Node.h"
 #include "src/OrthographicCamera.h"
@@ -249,6 +258,8 @@
 #include "src/Renderer.h"
 #include "src/RenderState.h"
 #include "src/RenderTraverser.h"
+#include "src/SceneArena.h"
+#include "src/SceneCompiler.h"
 #include "src/scg_glm.h"
 #include "src/scg_internals.h"
 #include "src/scg_stb_image.h"
@@ -257,12 +268,14 @@
 #include "src/ShaderCoreFactory.h"
 #include "src/Shape.h"
 #include "src/StandardRenderer.h"
+#include "src/StreamBuffer.h"
 #include "src/Texture2DCore.h"
 #include "src/TextureCore.h"
 #include "src/TextureCoreFactory.h"
 #include "src/TransformAnimation.h"
 #include "src/Transformation.h"
 #include "src/Traverser.h"
+#include "src/VertexLayout.h"
 #include "src/Viewer.h"
 #include "src/ViewState.h"
 
@@ -8,8 +8,8 @@
 in vec4 vVertex;
 in vec3 vNormal;
 in vec4 vTexCoord0;
-in vec3 vTangent;
-in vec3 vBinormal;
+in vec4 vTangent;     // w: handedness sign if binormals are not provided
+in vec3 vBinormal;    // (0, 0, 0) if not provided
 
 const int MAX_NUMBER_OF_LIGHTS = 10;
 
@@ -45,8 +45,9 @@ void main() {
   // transform vertex position, normal, tangent, and binormal into eye coordinates 
   ecVertex = (modelViewMatrix * vVertex).xyz;
   vec3 ecNormal = normalMatrix * vNormal;
-  vec3 ecTangent = normalMatrix * vTangent;
-  vec3 ecBinormal = normalMatrix * vBinormal;
+  vec3 ecTangent = normalMatrix * vTangent.xyz;
+  vec3 binormal = (dot(vBinormal, vBinormal) > 0.) ? vBinormal : vTangent.w * cross(vNormal, vTangent.xyz);
+  vec3 ecBinormal = normalMatrix * binormal;
       
   // create transformation to tangent space 
   vec3 ecN = normalize(ecNormal);
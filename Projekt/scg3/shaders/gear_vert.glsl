@@ -0,0 +1,220 @@
+/**
+ * \file gear_vert.glsl
+ * \brief Gear vertex shader (cf. GearCore), computes vertex position and normal
+ *    of an involute spur gear from gl_VertexID, without vertex attributes.
+ */
+
+#version 150
+
+uniform mat4 modelViewMatrix;
+uniform mat4 projectionMatrix;
+uniform mat4 mvpMatrix;
+uniform mat3 normalMatrix;
+uniform mat4 textureMatrix;
+
+// gear parameters, cf. GearCore and GeometryCoreFactory::createGear()
+layout(std140) uniform GearBlock {
+  int nTeeth;
+  int nFlankSegments;
+  int nArcSegments;
+  int nProfilePoints;     // outline points per tooth
+  bool hasRadialFlank;    // root circle inside base circle
+  float rootRadius;
+  float baseRadius;
+  float tipRadius;
+  float boreRadius;       // 0 for none
+  float startAngle;       // flank angle at roll angle 0
+  float minRollAngle;
+  float maxRollAngle;
+  float halfThickness;
+  float footAngle;        // flank angle at minimum roll angle
+  float tipAngle;         // flank angle at maximum roll angle
+  float rootStep;         // angle step of root arc
+  float flankStep;        // roll angle step of flanks
+};
+
+smooth out vec3 ecVertex;
+smooth out vec3 ecNormal;
+smooth out vec4 texCoord0;
+
+const float PI = 3.141592654;
+
+
+// --- declarations ---
+
+
+vec2 getOutlinePoint(const in int tooth, const in int k, out bool isCorner, out bool hasSpoke);
+
+vec2 getProfilePoint(in int k, out bool isCorner, out bool hasSpoke);
+
+vec2 getEdgeNormal(const in vec2 p0, const in vec2 p1);
+
+vec2 getDirection(const in float angle);
+
+
+// --- implementations ---
+
+
+void main() {
+
+  // each outline segment (from point k to k + 1 of a tooth) is drawn by
+  // two triangles each for front face, back face, outer wall, and bore wall
+  int nSegmentVertices = boreRadius > 0.0 ? 24 : 18;
+  int segment = gl_VertexID / nSegmentVertices;
+  int part = (gl_VertexID - segment * nSegmentVertices) / 6;
+  int corner = gl_VertexID - segment * nSegmentVertices - 6 * part;
+  int tooth = segment / nProfilePoints;
+  int k = segment - tooth * nProfilePoints;
+
+  // outline points k - 1 to k + 2 in polar coordinates (radius, angle)
+  bool isCorner[4];
+  bool hasSpoke[4];
+  vec2 polar[4];
+  for (int i = 0; i < 4; ++i) {
+    polar[i] = getOutlinePoint(tooth, k + i - 1, isCorner[i], hasSpoke[i]);
+  }
+  vec2 outline[4];
+  for (int i = 0; i < 4; ++i) {
+    outline[i] = polar[i].x * getDirection(polar[i].y);
+  }
+
+  // corners of both triangles: xy position, front (1) or back (-1) side, and normal
+  vec2 xy[6];
+  float side[6];
+  vec3 normal;
+  vec3 normals[6];
+  if (part < 2) {
+    // front or back face: quad between outline and bore circle (or center) from point k
+    // to the next spoke; points without spoke are covered by an outline triangle instead
+    int s = hasSpoke[2] ? 2 : 3;
+    vec2 inner0 = boreRadius * getDirection(polar[1].y);
+    vec2 innerS = boreRadius * getDirection(polar[s].y);
+    if (hasSpoke[1]) {
+      xy = vec2[6](inner0, outline[1], outline[s], inner0, outline[s], innerS);
+    }
+    else {
+      xy = vec2[6](outline[0], outline[1], outline[2], outline[1], outline[1], outline[1]);
+    }
+    if (part == 1) {
+      // reverse orientation of back face
+      xy = vec2[6](xy[0], xy[2], xy[1], xy[3], xy[5], xy[4]);
+    }
+    float z = part == 0 ? 1.0 : -1.0;
+    side = float[6](z, z, z, z, z, z);
+    normal = vec3(0.0, 0.0, z);
+    normals = vec3[6](normal, normal, normal, normal, normal, normal);
+  }
+  else if (part == 2) {
+    // outer wall between points k and k + 1, normals averaged at smooth points
+    vec2 edgeNormal = getEdgeNormal(outline[1], outline[2]);
+    vec3 normal0 = vec3(isCorner[1] ? edgeNormal
+        : normalize(getEdgeNormal(outline[0], outline[1]) + edgeNormal), 0.0);
+    vec3 normal1 = vec3(isCorner[2] ? edgeNormal
+        : normalize(edgeNormal + getEdgeNormal(outline[2], outline[3])), 0.0);
+    xy = vec2[6](outline[1], outline[2], outline[2], outline[1], outline[2], outline[1]);
+    side = float[6](-1.0, -1.0, 1.0, -1.0, 1.0, 1.0);
+    normals = vec3[6](normal0, normal1, normal1, normal0, normal1, normal0);
+  }
+  else {
+    // bore wall facing inwards, from point k to the next spoke
+    int s = hasSpoke[2] ? 2 : 3;
+    vec2 dir0 = getDirection(polar[1].y);
+    vec2 dirS = hasSpoke[1] ? getDirection(polar[s].y) : dir0;
+    xy = vec2[6](boreRadius * dir0, boreRadius * dirS, boreRadius * dirS,
+        boreRadius * dir0, boreRadius * dir0, boreRadius * dirS);
+    side = float[6](-1.0, 1.0, -1.0, -1.0, 1.0, 1.0);
+    normals = vec3[6](vec3(-dir0, 0.0), vec3(-dirS, 0.0), vec3(-dirS, 0.0),
+        vec3(-dir0, 0.0), vec3(-dir0, 0.0), vec3(-dirS, 0.0));
+  }
+  vec4 vertex = vec4(xy[corner], side[corner] * halfThickness, 1.0);
+
+  // transform vertex position and normal into eye coordinates
+  ecVertex = (modelViewMatrix * vertex).xyz;
+  ecNormal = normalMatrix * normals[corner];
+
+  // set output values, texture coordinates are projected along z axis
+  gl_Position = mvpMatrix * vertex;
+  texCoord0 = textureMatrix * vec4(0.5 + 0.5 * vertex.xy / tipRadius, 0.0, 1.0);
+}
+
+
+/**
+ * Get outline point k (-1 <= k < 2 * nProfilePoints) of a tooth in polar coordinates,
+ * continuing with the previous or next tooth outside the tooth.
+ */
+vec2 getOutlinePoint(const in int tooth, const in int k, out bool isCorner, out bool hasSpoke) {
+  int offset = k < 0 ? -1 : k / nProfilePoints;
+  vec2 polar = getProfilePoint(k - offset * nProfilePoints, isCorner, hasSpoke);
+  return vec2(polar.x, polar.y + float(tooth + offset) * 2.0 * PI / float(nTeeth));
+}
+
+
+/**
+ * Get profile point k (0 <= k < nProfilePoints) of the tooth centered at angle 0
+ * in polar coordinates, counterclockwise from angle -PI / nTeeth; corners are points
+ * with different normals on both sides, spokes connect outline and bore circle
+ * (except for base circle points of radial flanks).
+ */
+vec2 getProfilePoint(in int k, out bool isCorner, out bool hasSpoke) {
+  int nRadialPoints = hasRadialFlank ? 1 : 0;
+  isCorner = false;
+  hasSpoke = true;
+
+  // root arc
+  if (k < nArcSegments) {
+    return vec2(rootRadius, -PI / float(nTeeth) + float(k) * rootStep);
+  }
+  k -= nArcSegments;
+  if (k < nRadialPoints) {
+    isCorner = true;
+    return vec2(rootRadius, footAngle);
+  }
+  k -= nRadialPoints;
+
+  // rising flank (involute of base circle), tip arc, and falling flank (mirrored)
+  int i = -1;
+  float sign = 1.0;
+  if (k <= nFlankSegments) {
+    i = k;
+  }
+  else if (k <= 2 * nFlankSegments + nArcSegments) {
+    k -= nFlankSegments + 1;
+    if (k < nArcSegments - 1) {
+      return vec2(tipRadius, tipAngle - 2.0 * tipAngle * float(k + 1) / float(nArcSegments));
+    }
+    i = nFlankSegments - (k - nArcSegments + 1);
+    sign = -1.0;
+  }
+  if (i >= 0) {
+    float t = minRollAngle + float(i) * flankStep;
+    isCorner = (i == nFlankSegments) || (i == 0 && !hasRadialFlank);
+    hasSpoke = (i > 0) || !hasRadialFlank;
+    return vec2(baseRadius * sqrt(1.0 + t * t), sign * (startAngle + t - atan(t)));
+  }
+  k -= 2 * nFlankSegments + nArcSegments + 1;
+
+  // root arc
+  if (k < nRadialPoints) {
+    isCorner = true;
+    return vec2(rootRadius, -footAngle);
+  }
+  k -= nRadialPoints;
+  return vec2(rootRadius, -footAngle + float(k + 1) * rootStep);
+}
+
+
+/**
+ * Get outward normal of an outline edge (counterclockwise).
+ */
+vec2 getEdgeNormal(const in vec2 p0, const in vec2 p1) {
+  vec2 edge = p1 - p0;
+  return normalize(vec2(edge.y, -edge.x));
+}
+
+
+/**
+ * Get unit vector of a polar angle.
+ */
+vec2 getDirection(const in float angle) {
+  return vec2(cos(angle), sin(angle));
+}
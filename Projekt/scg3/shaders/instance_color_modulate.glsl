@@ -0,0 +1,16 @@
+/**
+ * \file instance_color_modulate.glsl
+ * \brief Determine fragment color without texture, modulated by the color of the instance
+ *    (cf. phong_instanced_vert.glsl), provides external function applyTexture()
+ *    to fragment shader.
+ */
+
+#version 150
+
+flat in vec4 instanceColor;
+
+
+vec4 applyTexture(const in vec4 texCoord, const in vec4 emissionAmbientDiffuse,
+    const in vec4 specular) {
+  return clamp(instanceColor * emissionAmbientDiffuse + specular, 0., 1.);
+}
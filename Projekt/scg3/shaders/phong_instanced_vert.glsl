@@ -0,0 +1,45 @@
+/**
+ * \file phong_instanced_vert.glsl
+ * \brief Phong vertex shader for instanced shapes (cf. InstancedShape),
+ *    reads transformation and color of each instance from a texture buffer.
+ */
+
+#version 150
+
+in vec4 vVertex;
+in vec3 vNormal;
+in vec4 vTexCoord0;
+
+uniform mat4 modelViewMatrix;
+uniform mat4 projectionMatrix;
+uniform mat3 normalMatrix;
+uniform mat4 textureMatrix;
+
+// per-instance data: transformation in texels 0..3, normal matrix in texels 4..6,
+// color in texel 7
+uniform samplerBuffer instanceData;
+
+smooth out vec3 ecVertex;
+smooth out vec3 ecNormal;
+smooth out vec4 texCoord0;
+flat out vec4 instanceColor;
+
+
+void main() {
+  
+  int base = 8 * gl_InstanceID;
+  mat4 instanceMatrix = mat4(texelFetch(instanceData, base), texelFetch(instanceData, base + 1),
+      texelFetch(instanceData, base + 2), texelFetch(instanceData, base + 3));
+  mat3 instanceNormalMatrix = mat3(texelFetch(instanceData, base + 4).xyz,
+      texelFetch(instanceData, base + 5).xyz, texelFetch(instanceData, base + 6).xyz);
+
+  // transform vertex position and normal into eye coordinates 
+  vec4 ecVertex4 = modelViewMatrix * (instanceMatrix * vVertex);
+  ecVertex = ecVertex4.xyz;
+  ecNormal = normalMatrix * (instanceNormalMatrix * vNormal);
+      
+  // set output values
+  gl_Position = projectionMatrix * ecVertex4;
+  texCoord0 = textureMatrix * vTexCoord0;
+  instanceColor = texelFetch(instanceData, base + 7);
+}
@@ -8,6 +8,7 @@
 in vec4 vVertex;
 in vec3 vNormal;
 in vec4 vTexCoord0;
+in float vDrawID;
 
 uniform mat4 modelViewMatrix;
 uniform mat4 projectionMatrix;
@@ -15,6 +16,12 @@ uniform mat4 mvpMatrix;
 uniform mat3 normalMatrix;
 uniform mat4 textureMatrix;
 
+// per-draw matrices of batched draw calls (cf. DrawBatcher):
+// model-view matrix in texels 0..3, normal matrix in texels 4..6,
+// consecutive draw IDs for instances of automatically instanced draw calls
+uniform bool isDrawDataEnabled;
+uniform samplerBuffer drawData;
+
 smooth out vec3 ecVertex;
 smooth out vec3 ecNormal;
 smooth out vec4 texCoord0;
@@ -22,11 +29,21 @@ smooth out vec4 texCoord0;
 
 void main() {
   
+  mat4 mvMatrix = modelViewMatrix;
+  mat3 nMatrix = normalMatrix;
+  if (isDrawDataEnabled) {
+    int base = 7 * (int(vDrawID) + gl_InstanceID);
+    mvMatrix = mat4(texelFetch(drawData, base), texelFetch(drawData, base + 1),
+        texelFetch(drawData, base + 2), texelFetch(drawData, base + 3));
+    nMatrix = mat3(texelFetch(drawData, base + 4).xyz, texelFetch(drawData, base + 5).xyz,
+        texelFetch(drawData, base + 6).xyz);
+  }
+
   // transform vertex position and normal into eye coordinates 
-  ecVertex = (modelViewMatrix * vVertex).xyz;
-  ecNormal = normalMatrix * vNormal;
+  ecVertex = (mvMatrix * vVertex).xyz;
+  ecNormal = nMatrix * vNormal;
       
   // set output values
-  gl_Position = mvpMatrix * vVertex;
+  gl_Position = isDrawDataEnabled ? projectionMatrix * (mvMatrix * vVertex) : mvpMatrix * vVertex;
   texCoord0 = textureMatrix * vTexCoord0;
 }
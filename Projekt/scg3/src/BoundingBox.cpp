@@ -0,0 +1,126 @@
+/**
+ * \file BoundingBox.cpp
+ *
+ * \author Projektgruppe "Zahnradapparatus"
+ */
+
+/*
+ * Copyright 2026 Projektgruppe "Zahnradapparatus"
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cfloat>
+#include <cmath>
+#include "BoundingBox.h"
+
+namespace scg {
+
+
+BoundingBox::BoundingBox()
+    : min_(FLT_MAX), max_(-FLT_MAX), isInfinite_(false) {
+}
+
+
+BoundingBox::BoundingBox(const glm::vec3& boundsMin, const glm::vec3& boundsMax)
+    : min_(boundsMin), max_(boundsMax), isInfinite_(false) {
+}
+
+
+BoundingBox BoundingBox::createInfinite() {
+  BoundingBox result;
+  result.isInfinite_ = true;
+  return result;
+}
+
+
+bool BoundingBox::isEmpty() const {
+  return !isInfinite_ && (min_.x > max_.x || min_.y > max_.y || min_.z > max_.z);
+}
+
+
+bool BoundingBox::isInfinite() const {
+  return isInfinite_;
+}
+
+
+const glm::vec3& BoundingBox::getMin() const {
+  return min_;
+}
+
+
+const glm::vec3& BoundingBox::getMax() const {
+  return max_;
+}
+
+
+void BoundingBox::extend(const glm::vec3& point) {
+  min_ = glm::min(min_, point);
+  max_ = glm::max(max_, point);
+}
+
+
+void BoundingBox::extend(const BoundingBox& box) {
+  if (box.isInfinite_) {
+    isInfinite_ = true;
+  }
+  else if (!box.isEmpty()) {
+    min_ = glm::min(min_, box.min_);
+    max_ = glm::max(max_, box.max_);
+  }
+}
+
+
+BoundingBox BoundingBox::transform(const glm::mat4& matrix) const {
+  if (isInfinite_ || isEmpty()) {
+    return *this;
+  }
+
+  // transform center, extent is sum of absolute values of transformed half axes (affine matrix)
+  const glm::vec3 center(matrix * glm::vec4(0.5f * (min_ + max_), 1.f));
+  const glm::vec3 halfSize(0.5f * (max_ - min_));
+  glm::vec3 extent(0.f);
+  for (int i = 0; i < 3; ++i) {
+    extent += glm::abs(glm::vec3(matrix[i])) * halfSize[i];
+  }
+  return BoundingBox(center - extent, center + extent);
+}
+
+
+bool BoundingBox::isOutsideFrustum(const glm::mat4& clipMatrix) const {
+  if (isInfinite_) {
+    return false;
+  }
+  if (isEmpty()) {
+    return true;
+  }
+
+  // planes -w <= x, y, z <= w in clip coordinates (Gribb/Hartmann),
+  // test corner that is farthest in direction of plane normal
+  const glm::vec4 rowW(clipMatrix[0][3], clipMatrix[1][3], clipMatrix[2][3], clipMatrix[3][3]);
+  for (int i = 0; i < 3; ++i) {
+    const glm::vec4 row(clipMatrix[0][i], clipMatrix[1][i], clipMatrix[2][i], clipMatrix[3][i]);
+    for (int sign = -1; sign <= 1; sign += 2) {
+      const glm::vec4 plane = rowW + static_cast<float>(sign) * row;
+      const glm::vec3 corner(plane.x >= 0.f ? max_.x : min_.x, plane.y >= 0.f ? max_.y : min_.y,
+          plane.z >= 0.f ? max_.z : min_.z);
+      if (glm::dot(glm::vec3(plane), corner) + plane.w < 0.f) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+
+} /* namespace scg */
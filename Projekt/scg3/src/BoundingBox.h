@@ -0,0 +1,111 @@
+/**
+ * \file BoundingBox.h
+ * \brief Axis-aligned bounding box, used for view-frustum culling.
+ *
+ * \author Projektgruppe "Zahnradapparatus"
+ */
+
+/*
+ * Copyright 2026 Projektgruppe "Zahnradapparatus"
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BOUNDINGBOX_H_
+#define BOUNDINGBOX_H_
+
+#include "scg_glm.h"
+
+namespace scg {
+
+
+/**
+ * \brief Axis-aligned bounding box, used for view-frustum culling.
+ *
+ * A box may be empty (nothing to be drawn) or infinite (unknown extent, never culled,
+ * e.g., for nodes whose effect is not limited to their geometry, like cameras).
+ */
+class BoundingBox {
+
+public:
+
+  /**
+   * Constructor, creates an empty box.
+   */
+  BoundingBox();
+
+  /**
+   * Constructor with minimum and maximum corner.
+   */
+  BoundingBox(const glm::vec3& boundsMin, const glm::vec3& boundsMax);
+
+  /**
+   * Create infinite box.
+   */
+  static BoundingBox createInfinite();
+
+  /**
+   * Check if box does not contain any point.
+   */
+  bool isEmpty() const;
+
+  /**
+   * Check if box is infinite.
+   */
+  bool isInfinite() const;
+
+  /**
+   * Get minimum corner (undefined for empty or infinite boxes).
+   */
+  const glm::vec3& getMin() const;
+
+  /**
+   * Get maximum corner (undefined for empty or infinite boxes).
+   */
+  const glm::vec3& getMax() const;
+
+  /**
+   * Extend box to contain a point.
+   */
+  void extend(const glm::vec3& point);
+
+  /**
+   * Extend box to contain another box.
+   */
+  void extend(const BoundingBox& box);
+
+  /**
+   * Get box that contains this box after transformation by a matrix.
+   */
+  BoundingBox transform(const glm::mat4& matrix) const;
+
+  /**
+   * Check if box is completely outside one of the six frustum planes, which are
+   * extracted from the matrix that transforms box coordinates into clip coordinates.
+   *
+   * \param clipMatrix projection matrix times model-view matrix
+   */
+  bool isOutsideFrustum(const glm::mat4& clipMatrix) const;
+
+protected:
+
+  glm::vec3 min_;
+  glm::vec3 max_;
+  bool isInfinite_;
+
+};
+
+
+} /* namespace scg */
+
+#endif /* BOUNDINGBOX_H_ */
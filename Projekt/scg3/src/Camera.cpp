@@ -237,6 +237,12 @@ void Camera::update_() {
   // update transformation matrix and camera
   matrix_ = glm::mat4(glm::vec4(rightDir_, 0.f), glm::vec4(upDir_, 0.f),
       glm::vec4(-viewDir_, 0.f), glm::vec4(eyePt_, 1.f));
+  invalidateWorldMatrix();
+}
+
+
+BoundingBox Camera::computeBoundingBox_() {
+  return BoundingBox::createInfinite();
 }
 
 
@@ -268,6 +268,11 @@ protected:
    */
   virtual void update_();
 
+  /**
+   * Compute bounding box: infinite, since the camera defines the view of the whole scene.
+   */
+  virtual BoundingBox computeBoundingBox_();
+
 protected:
 
   glm::mat4 projection_;
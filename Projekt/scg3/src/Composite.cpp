@@ -21,8 +21,11 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <cassert>
+#include <utility>
 #include "Composite.h"
+#include "Traverser.h"
 
 namespace scg {
 
@@ -32,17 +35,49 @@ Composite::Composite() {
 
 
 Composite::~Composite() {
+  // release sub-tree iteratively to avoid deeply nested destructor calls:
+  // children of composite nodes that are not referenced elsewhere are taken over
+  // before the composite node itself is deleted
+  std::vector<std::pair<NodeSP, Composite*>> stack;
+  takeChildren_(this, stack);
+  while (!stack.empty()) {
+    NodeSP node = std::move(stack.back().first);
+    Composite* parent = stack.back().second;
+    stack.pop_back();
+    if (node.use_count() > 1) {
+      // node survives (e.g., shared node), detach it from this sub-tree
+      node->removeParent_(parent);
+      continue;
+    }
+    Composite* composite = node->asComposite_();
+    if (composite) {
+      takeChildren_(composite, stack);
+    }
+  }
 }
 
 
 void Composite::destroy() {
-  // destroy children (if any)
-  if (leftChild_) {
-    leftChild_->destroy();
+  // destroy nodes of sub-tree (if any) iteratively, using an explicit stack;
+  // shared nodes are destroyed when they are detached from their last parent
+  std::vector<std::pair<NodeSP, Composite*>> stack;
+  takeChildren_(this, stack);
+  while (!stack.empty()) {
+    NodeSP node = std::move(stack.back().first);
+    Composite* parent = stack.back().second;
+    stack.pop_back();
+    node->removeParent_(parent);
+    if (node->parent_) {
+      continue;
+    }
+    Composite* composite = node->asComposite_();
+    if (composite) {
+      takeChildren_(composite, stack);
+    }
+    node->clear();
   }
 
-  // clear smart pointer
-  leftChild_.reset();
+  incrementStructureGeneration_();
 
   // destroy node
   Node::destroy();
@@ -51,33 +86,26 @@ void Composite::destroy() {
 
 Composite* Composite::addChild(NodeSP child) {
   assert(child);
-  if (!leftChild_) {
-    // no left child yet, add left child
-    leftChild_ = child;
-    child->parent_ = this;
-  }
-  else {
-    // add new sibling to left child (recursively)
-    leftChild_->addSibling_(child);
-  }
+  children_.push_back(child);
+  child->addParent_(this);
+  child->invalidateWorldMatrix();
+  invalidateBoundingBox();
+  incrementStructureGeneration_();
   return this;
 }
 
 
 Composite* Composite::removeChild(Node* node, bool& result) {
   assert(node);
-  result = false;
-  if (leftChild_) {
-    // check if node to remove is left child
-    if (node == leftChild_.get()) {
-      // remove left child
-      leftChild_ = node->rightSibling_;
-      result = true;
-    }
-    else {
-      // search siblings of left child for node to remove (recursively)
-      leftChild_->removeSibling_(node, result);
-    }
+  auto it = std::find_if(children_.begin(), children_.end(),
+      [node](const NodeSP& child) { return child.get() == node; });
+  result = (it != children_.end());
+  if (result) {
+    node->removeParent_(this);
+    node->invalidateWorldMatrix();
+    children_.erase(it);
+    invalidateBoundingBox();
+    incrementStructureGeneration_();
   }
   return this;
 }
@@ -90,23 +118,63 @@ Composite* Composite::removeChild(Node* node) {
 
 
 void Composite::traverse(Traverser* traverser) {
-  // check if node and its sub-tree are visible
-  if (isVisible_) {
-    // process node
-    accept(traverser);
-
-    // recursively traverse children (if any)
-    if (leftChild_) {
-      leftChild_->traverse(traverser);
+  // check if node and its sub-tree are visible and not culled
+  if (!isVisible_ || traverser->isCulled(this)) {
+    return;
+  }
+
+  // process node
+  accept(traverser);
+
+  // traverse sub-tree iteratively, the stack holds composite nodes being processed
+  // and the index of their next child
+  std::vector<std::pair<Composite*, size_t>> stack;
+  stack.reserve(16);
+  stack.push_back(std::make_pair(this, 0));
+  while (!stack.empty()) {
+    Composite* composite = stack.back().first;
+    size_t& childIndex = stack.back().second;
+    if (childIndex < composite->children_.size()) {
+      // process next child, descend into its sub-tree
+      Node* child = composite->children_[childIndex++].get();
+      if (child->isVisible_ && !traverser->isCulled(child)) {
+        child->accept(traverser);
+        Composite* childComposite = child->asComposite_();
+        if (childComposite) {
+          stack.push_back(std::make_pair(childComposite, 0));
+        }
+      }
+    }
+    else {
+      // all children processed, post-process node
+      composite->acceptPost(traverser);
+      stack.pop_back();
     }
+  }
+}
+
 
-    // post-process node
-    acceptPost(traverser);
+void Composite::invalidateWorldMatrix() {
+  if (!invalidateOwnWorldMatrix_()) {
+    return;
   }
 
-  // recursively traverse siblings (if any)
-  if (rightSibling_) {
-    rightSibling_->traverse(traverser);
+  // descendants of an outdated transformation are outdated as well,
+  // i.e., sub-trees of outdated transformations can be skipped
+  std::vector<Composite*> stack;
+  Composite* composite = this;
+  while (composite) {
+    for (auto& child : composite->children_) {
+      Composite* childComposite = child->asComposite_();
+      if (childComposite && childComposite->invalidateOwnWorldMatrix_()) {
+        stack.push_back(childComposite);
+      }
+    }
+    composite = nullptr;
+    if (!stack.empty()) {
+      composite = stack.back();
+      stack.pop_back();
+    }
   }
 }
 
@@ -121,4 +189,32 @@ void Composite::renderPost(RenderState* renderState) {
 }
 
 
+Composite* Composite::asComposite_() {
+  return this;
+}
+
+
+void Composite::takeChildren_(Composite* composite,
+    std::vector<std::pair<NodeSP, Composite*>>& stack) {
+  for (auto& child : composite->children_) {
+    stack.push_back(std::make_pair(std::move(child), composite));
+  }
+  composite->children_.clear();
+}
+
+
+bool Composite::invalidateOwnWorldMatrix_() {
+  return true;
+}
+
+
+BoundingBox Composite::computeBoundingBox_() {
+  BoundingBox result;
+  for (auto& child : children_) {
+    result.extend(child->getBoundingBox());
+  }
+  return result;
+}
+
+
 } /* namespace scg */
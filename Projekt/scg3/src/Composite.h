@@ -25,6 +25,8 @@
 #ifndef COMPOSITE_H_
 #define COMPOSITE_H_
 
+#include <utility>
+#include <vector>
 #include "Node.h"
 #include "scg_internals.h"
 
@@ -33,6 +35,11 @@ namespace scg {
 
 /**
  * \brief Base class for all composite nodes, i.e., nodes with children (composite pattern, abstract).
+ *
+ * Children are stored in a contiguous vector in the order they have been added.
+ * The sub-tree is traversed and destroyed iteratively, using an explicit stack.
+ * A child may be added to several composite nodes (shared sub-tree), in which case
+ * it is traversed once per path from the root.
  */
 class Composite: public Node {
 
@@ -44,17 +51,21 @@ public:
   Composite();
 
   /**
-   * Destructor.
+   * Destructor, releases sub-tree iteratively.
    */
   virtual ~Composite() = 0;
 
   /**
    * Remove node from scene graph, destroy nodes of sub-tree (if any).
+   * Shared nodes that are still children of composite nodes outside the sub-tree
+   * are only detached from it.
    */
   virtual void destroy();
 
   /**
-   * Add child to composite node.
+   * Add child to composite node. The child may already be a child of other
+   * composite nodes, which results in a shared sub-tree, but the node tree
+   * must not contain cycles.
    * \return this pointer for method chaining
    */
   Composite* addChild(NodeSP child);
@@ -74,10 +85,17 @@ public:
   Composite* removeChild(Node* node);
 
   /**
-   * Traverse node tree (depth-first, pre-order) with given traverser.
+   * Traverse node tree (depth-first, pre-order) with given traverser,
+   * iteratively, using an explicit stack.
    */
   virtual void traverse(Traverser* traverser);
 
+  /**
+   * Mark cached world matrices of the transformations in the sub-tree as outdated,
+   * iteratively, skipping sub-trees of transformations that are already outdated.
+   */
+  virtual void invalidateWorldMatrix();
+
   /**
    * Accept traverser after traversing sub-tree (visitor pattern).
    */
@@ -90,7 +108,34 @@ public:
 
 protected:
 
-  NodeSP leftChild_;
+  /**
+   * Get this node as composite node.
+   * \return this pointer
+   */
+  virtual Composite* asComposite_();
+
+  /**
+   * Move children of given composite node to stack of (child, parent) pairs,
+   * called to release or destroy the sub-tree iteratively.
+   */
+  static void takeChildren_(Composite* composite,
+      std::vector<std::pair<NodeSP, Composite*>>& stack);
+
+  /**
+   * Mark cached world matrix of this node as outdated, called by invalidateWorldMatrix().
+   * \return false if the world matrix has been outdated already, i.e., the sub-tree
+   *   does not need to be processed; true by default
+   */
+  virtual bool invalidateOwnWorldMatrix_();
+
+  /**
+   * Compute bounding box as union of the bounding boxes of all children.
+   */
+  virtual BoundingBox computeBoundingBox_();
+
+protected:
+
+  std::vector<NodeSP> children_;
 
 };
 
@@ -0,0 +1,247 @@
+/**
+ * \file DrawBatcher.cpp
+ *
+ * \author Projektgruppe "Zahnradapparatus"
+ */
+
+/*
+ * Copyright 2026 Projektgruppe "Zahnradapparatus"
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cassert>
+#include <memory>
+#include "Core.h"
+#include "DrawBatcher.h"
+#include "GeometryCore.h"
+#include "RenderState.h"
+#include "ShaderCore.h"
+#include "Shape.h"
+#include "scg_utilities.h"
+
+namespace scg {
+
+
+DrawBatcher::DrawBatcher()
+    : nDraws_(0), drawDataBuffer_(0), drawDataTexture_(0), drawCommandBuffer_(0),
+      isInitialized_(false), isMultiDrawIndirectSupported_(false) {
+}
+
+
+DrawBatcher::~DrawBatcher() {
+  if (isInitialized_ && isGLContextActive()) {
+    glDeleteTextures(1, &drawDataTexture_);
+    glDeleteBuffers(1, &drawDataBuffer_);
+    glDeleteBuffers(1, &drawCommandBuffer_);
+  }
+}
+
+
+DrawBatcherSP DrawBatcher::create() {
+  return std::make_shared<DrawBatcher>();
+}
+
+
+bool DrawBatcher::addShape(Shape* shape, RenderState* renderState) {
+  // check if shape and current shader allow batching
+  ShaderCore* shader = renderState->getShader();
+  if (shape->cores_.empty() || !shader
+      || shader->getUniformLoc(OGLConstants::DRAW_DATA_ENABLED) < 0) {
+    return false;
+  }
+  auto geometryCore = dynamic_cast<GeometryCore*>(shape->cores_.back().get());
+  DrawElementsIndirectCommand command;
+  if (!geometryCore || !geometryCore->getDrawCommand(renderState, command)) {
+    return false;
+  }
+  tempCores_.clear();
+  for (size_t i = 0; i + 1 < shape->cores_.size(); ++i) {
+    Core* core = shape->cores_[i].get();
+    if (dynamic_cast<GeometryCore*>(core) || dynamic_cast<ShaderCore*>(core)) {
+      return false;
+    }
+    tempCores_.push_back(core);
+  }
+
+  if (!isInitialized_) {
+    init_();
+  }
+  if (nDraws_ == GeometryArena::MAX_DRAW_IDS) {
+    flush(renderState);
+  }
+
+  // indirect drawing requires the instanced draw ID attribute of arena VAOs
+  Bucket& bucket = getBucket_(tempCores_, geometryCore->getVAO(),
+      geometryCore->getPrimitiveType(), geometryCore->getIndexType(),
+      isMultiDrawIndirectSupported_ && geometryCore->isStoredInArena());
+  command.baseInstance = static_cast<GLuint>(bucket.drawData.size() / 7);
+  DrawElementsIndirectCommand* last = bucket.commands.empty() ? nullptr : &bucket.commands.back();
+  if (!bucket.isIndirect && last && last->count == command.count
+      && last->firstIndex == command.firstIndex && last->baseVertex == command.baseVertex) {
+    // same geometry as previous shape of bucket: draw as further instance
+    ++last->instanceCount;
+  }
+  else {
+    bucket.commands.push_back(command);
+  }
+
+  // store per-draw matrices as 7 texels (model-view and normal matrix columns)
+  glm::mat4 modelView = renderState->modelViewStack.getMatrix();
+  if (geometryCore->hasVertexTransform()) {
+    modelView *= geometryCore->getVertexTransform();
+  }
+  const glm::mat3 normalMatrix = glm::transpose(glm::inverse(glm::mat3(modelView)));
+  for (int i = 0; i < 4; ++i) {
+    bucket.drawData.push_back(modelView[i]);
+  }
+  for (int i = 0; i < 3; ++i) {
+    bucket.drawData.push_back(glm::vec4(normalMatrix[i], 0.0f));
+  }
+  ++nDraws_;
+  return true;
+}
+
+
+void DrawBatcher::flush(RenderState* renderState) {
+  if (nDraws_ == 0) {
+    return;
+  }
+
+  // concatenate per-draw data of all buckets, such that draw IDs become absolute
+  drawData_.clear();
+  for (auto& bucket : buckets_) {
+    const GLuint firstDrawID = static_cast<GLuint>(drawData_.size() / 7);
+    for (auto& command : bucket.commands) {
+      command.baseInstance += firstDrawID;
+    }
+    drawData_.insert(drawData_.end(), bucket.drawData.begin(), bucket.drawData.end());
+  }
+
+  // upload per-draw data, orphaning previous buffer contents
+  glBindBuffer(GL_TEXTURE_BUFFER, drawDataBuffer_);
+  glBufferData(GL_TEXTURE_BUFFER, drawData_.size() * sizeof(glm::vec4), drawData_.data(),
+      GL_STREAM_DRAW);
+  glBindBuffer(GL_TEXTURE_BUFFER, 0);
+  glActiveTexture(GL_TEXTURE0 + OGLConstants::DRAW_DATA.texUnit);
+  glBindTexture(GL_TEXTURE_BUFFER, drawDataTexture_);
+  glActiveTexture(GL_TEXTURE0);
+
+  // upload draw commands of all indirect buckets into one indirect buffer
+  if (isMultiDrawIndirectSupported_) {
+    drawCommands_.clear();
+    for (auto& bucket : buckets_) {
+      if (bucket.isIndirect) {
+        drawCommands_.insert(drawCommands_.end(), bucket.commands.begin(),
+            bucket.commands.end());
+      }
+    }
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, drawCommandBuffer_);
+    glBufferData(GL_DRAW_INDIRECT_BUFFER,
+        drawCommands_.size() * sizeof(DrawElementsIndirectCommand), drawCommands_.data(),
+        GL_STREAM_DRAW);
+  }
+
+  // draw buckets
+  ShaderCore* shader = renderState->getShader();
+  assert(shader);
+  shader->setUniform1i(OGLConstants::DRAW_DATA_ENABLED, 1);
+  size_t commandOffset = 0;
+  for (auto& bucket : buckets_) {
+    for (auto core : bucket.cores) {
+      core->render(renderState);
+    }
+    renderState->passToShader();
+    glBindVertexArray(bucket.vao);
+    assert(glIsVertexArray(bucket.vao));
+    if (bucket.isIndirect) {
+      glMultiDrawElementsIndirect(bucket.primitiveType, bucket.indexType,
+          reinterpret_cast<const GLvoid*>(commandOffset * sizeof(DrawElementsIndirectCommand)),
+          static_cast<GLsizei>(bucket.commands.size()), 0);
+      commandOffset += bucket.commands.size();
+    }
+    else {
+      for (auto& command : bucket.commands) {
+        glVertexAttrib1f(OGLConstants::DRAW_ID.location, static_cast<GLfloat>(command.baseInstance));
+        GLvoid* offset = reinterpret_cast<GLvoid*>(command.firstIndex
+            * GeometryCore::getIndexSize(bucket.indexType));
+        if (command.instanceCount == 1) {
+          glDrawElementsBaseVertex(bucket.primitiveType, static_cast<GLsizei>(command.count),
+              bucket.indexType, offset, command.baseVertex);
+        }
+        else {
+          glDrawElementsInstancedBaseVertex(bucket.primitiveType,
+              static_cast<GLsizei>(command.count), bucket.indexType, offset,
+              static_cast<GLsizei>(command.instanceCount), command.baseVertex);
+        }
+      }
+    }
+    glBindVertexArray(0);
+    for (auto rit = bucket.cores.rbegin(); rit != bucket.cores.rend(); ++rit) {
+      (*rit)->renderPost(renderState);
+    }
+  }
+  shader->setUniform1i(OGLConstants::DRAW_DATA_ENABLED, 0);
+  if (isMultiDrawIndirectSupported_) {
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+  }
+
+  buckets_.clear();
+  drawData_.clear();
+  nDraws_ = 0;
+
+  assert(!checkGLError());
+}
+
+
+DrawBatcher::Bucket& DrawBatcher::getBucket_(const std::vector<Core*>& cores, GLuint vao,
+    GLenum primitiveType, GLenum indexType, bool isIndirect) {
+  // linear search, since the number of buckets per flush is small
+  for (auto& bucket : buckets_) {
+    if (bucket.vao == vao && bucket.primitiveType == primitiveType
+        && bucket.indexType == indexType && bucket.cores == cores) {
+      return bucket;
+    }
+  }
+  Bucket bucket;
+  bucket.cores = cores;
+  bucket.vao = vao;
+  bucket.primitiveType = primitiveType;
+  bucket.indexType = indexType;
+  bucket.isIndirect = isIndirect;
+  buckets_.push_back(bucket);
+  return buckets_.back();
+}
+
+
+void DrawBatcher::init_() {
+  isMultiDrawIndirectSupported_ = GeometryArena::isMultiDrawIndirectSupported();
+  glGenBuffers(1, &drawDataBuffer_);
+  glBindBuffer(GL_TEXTURE_BUFFER, drawDataBuffer_);
+  assert(glIsBuffer(drawDataBuffer_));
+  glBindBuffer(GL_TEXTURE_BUFFER, 0);
+  glGenTextures(1, &drawDataTexture_);
+  glActiveTexture(GL_TEXTURE0 + OGLConstants::DRAW_DATA.texUnit);
+  glBindTexture(GL_TEXTURE_BUFFER, drawDataTexture_);
+  glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, drawDataBuffer_);
+  glActiveTexture(GL_TEXTURE0);
+  if (isMultiDrawIndirectSupported_) {
+    glGenBuffers(1, &drawCommandBuffer_);
+  }
+  isInitialized_ = true;
+
+  assert(!checkGLError());
+}
+
+
+} /* namespace scg */
@@ -0,0 +1,153 @@
+/**
+ * \file DrawBatcher.h
+ * \brief Collects shapes stored in geometry arenas and draws them with few draw calls.
+ *
+ * \author Projektgruppe "Zahnradapparatus"
+ */
+
+/*
+ * Copyright 2026 Projektgruppe "Zahnradapparatus"
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DRAWBATCHER_H_
+#define DRAWBATCHER_H_
+
+#include <vector>
+#include "scg_glew.h"
+#include "scg_glm.h"
+#include "scg_internals.h"
+#include "GeometryArena.h"
+
+namespace scg {
+
+
+class Core;
+class RenderState;
+class Shape;
+
+
+/**
+ * \brief Collects shapes stored in geometry arenas and draws them with few draw calls.
+ *
+ * Shapes are sorted into buckets of equal state, i.e., equal vertex array object,
+ * primitive type, index type, and cores other than their geometry core (e.g., material or texture).
+ * The model-view and normal matrices of each shape are stored in a texture buffer,
+ * which the shader reads by the draw ID attribute (OGLConstants::DRAW_ID) when the
+ * uniform OGLConstants::DRAW_DATA_ENABLED is set (cf. phong_vert.glsl).
+ *
+ * Buckets of geometry cores stored in a GeometryArena are drawn by one
+ * glMultiDrawElementsIndirect() call if supported (OpenGL 4.3), where the base instance
+ * of each command selects its draw ID.
+ *
+ * Otherwise, successive shapes of a bucket that share the same geometry (and level of detail)
+ * are merged into one instanced draw call, i.e., shapes that differ only in their
+ * transformation are instanced automatically. The draw ID of the first instance is passed
+ * as constant vertex attribute, and the shader adds gl_InstanceID. This applies to geometry
+ * cores with their own vertex array object, too, which have a bucket of their own.
+ *
+ * A shape is batched if
+ * - its last core is its only GeometryCore, drawn with element indices, without draw ranges,
+ *   and without stream buffer,
+ * - it does not contain a ShaderCore, and
+ * - the current shader declares the uniform OGLConstants::DRAW_DATA_ENABLED.
+ *
+ * Batched shapes are drawn by flush(), which has to be called before the render state
+ * changes in other ways than by the model-view matrix (cf. RenderTraverser).
+ */
+class DrawBatcher {
+
+public:
+
+  /**
+   * Constructor.
+   */
+  DrawBatcher();
+
+  /**
+   * Destructor.
+   */
+  virtual ~DrawBatcher();
+
+  /**
+   * Create shared pointer.
+   */
+  static DrawBatcherSP create();
+
+  /**
+   * Add shape to be drawn by next flush(), using the current model-view matrix.
+   *
+   * \return false if the shape cannot be batched and has to be rendered directly
+   */
+  bool addShape(Shape* shape, RenderState* renderState);
+
+  /**
+   * Draw all shapes added since the last call.
+   */
+  void flush(RenderState* renderState);
+
+protected:
+
+  /**
+   * Shapes of equal state, drawn by one multi-draw call or by instanced draw calls.
+   * Base instances of commands are relative to the first draw of the bucket
+   * until flush().
+   */
+  struct Bucket {
+    std::vector<Core*> cores;
+    GLuint vao;
+    GLenum primitiveType;
+    GLenum indexType;
+    bool isIndirect;
+    std::vector<DrawElementsIndirectCommand> commands;
+    std::vector<glm::vec4> drawData;
+  };
+
+  /**
+   * Find bucket of equal state or create new one.
+   */
+  Bucket& getBucket_(const std::vector<Core*>& cores, GLuint vao, GLenum primitiveType,
+      GLenum indexType, bool isIndirect);
+
+  /**
+   * Create buffers and texture on first use, when an OpenGL context exists.
+   */
+  void init_();
+
+protected:
+
+  std::vector<Bucket> buckets_;
+  std::vector<Core*> tempCores_;
+  std::vector<glm::vec4> drawData_;
+  std::vector<DrawElementsIndirectCommand> drawCommands_;
+  GLsizei nDraws_;
+  GLuint drawDataBuffer_;
+  GLuint drawDataTexture_;
+  GLuint drawCommandBuffer_;
+  bool isInitialized_;
+  bool isMultiDrawIndirectSupported_;
+
+private:
+
+  /**
+   * Disallow copy constructor and assignment operator.
+   */
+  SCG_DISALLOW_COPY_AND_ASSIGN(DrawBatcher);
+
+};
+
+
+} /* namespace scg */
+
+#endif /* DRAWBATCHER_H_ */
@@ -0,0 +1,185 @@
+/**
+ * \file GearCore.cpp
+ *
+ * \author Projektgruppe "Zahnradapparatus"
+ */
+
+/*
+ * Copyright 2026 Projektgruppe "Zahnradapparatus"
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cassert>
+#include <cstring>
+#include "GearCore.h"
+#include "GearProfile.h"
+#include "RenderState.h"
+#include "scg_utilities.h"
+
+namespace scg {
+
+
+GearCore::GearCore(int nTeeth, GLfloat module, GLfloat pressureAngleDeg, GLfloat thickness,
+    GLfloat boreRadius, int nFlankSegments)
+    : GeometryCore(GL_TRIANGLES, DrawMode::ARRAYS), ubo_(0), uboOld_(0),
+      nTeeth_(nTeeth), module_(module), pressureAngleDeg_(pressureAngleDeg),
+      thickness_(thickness), boreRadius_(boreRadius), nFlankSegments_(nFlankSegments),
+      tipRadius_(0.f) {
+  glGenBuffers(1, &ubo_);
+  update_();
+
+  assert(!checkGLError());
+}
+
+
+GearCore::~GearCore() {
+  if (isGLContextActive()) {
+    glDeleteBuffers(1, &ubo_);
+  }
+}
+
+
+GearCoreSP GearCore::create(int nTeeth, GLfloat module, GLfloat pressureAngleDeg,
+    GLfloat thickness, GLfloat boreRadius, int nFlankSegments) {
+  return std::make_shared<GearCore>(nTeeth, module, pressureAngleDeg, thickness, boreRadius,
+      nFlankSegments);
+}
+
+
+GearCore* GearCore::setNTeeth(int nTeeth) {
+  nTeeth_ = nTeeth;
+  update_();
+  return this;
+}
+
+
+GearCore* GearCore::setModule(GLfloat module) {
+  module_ = module;
+  update_();
+  return this;
+}
+
+
+GearCore* GearCore::setPressureAngle(GLfloat pressureAngleDeg) {
+  pressureAngleDeg_ = pressureAngleDeg;
+  update_();
+  return this;
+}
+
+
+GearCore* GearCore::setThickness(GLfloat thickness) {
+  thickness_ = thickness;
+  update_();
+  return this;
+}
+
+
+GearCore* GearCore::setBoreRadius(GLfloat boreRadius) {
+  boreRadius_ = boreRadius;
+  update_();
+  return this;
+}
+
+
+GearCore* GearCore::setNFlankSegments(int nFlankSegments) {
+  nFlankSegments_ = nFlankSegments;
+  update_();
+  return this;
+}
+
+
+int GearCore::getNTeeth() const {
+  return nTeeth_;
+}
+
+
+GLfloat GearCore::getModule() const {
+  return module_;
+}
+
+
+GLfloat GearCore::getTipRadius() const {
+  return tipRadius_;
+}
+
+
+void GearCore::render(RenderState* renderState) {
+  glGetIntegeri_v(GL_UNIFORM_BUFFER_BINDING, OGLConstants::GEAR.bindingPoint, &uboOld_);
+  glBindBufferBase(GL_UNIFORM_BUFFER, OGLConstants::GEAR.bindingPoint, ubo_);
+  assert(glIsBuffer(ubo_));
+
+  GeometryCore::render(renderState);
+
+  glBindBufferBase(GL_UNIFORM_BUFFER, OGLConstants::GEAR.bindingPoint, uboOld_);
+
+  assert(!checkGLError());
+}
+
+
+void GearCore::update_() {
+
+  // tooth profile, evaluated per vertex by the gear shader from the parameters below
+  const GearProfile gear(nTeeth_, module_, pressureAngleDeg_, nFlankSegments_);
+  assert(boreRadius_ < gear.rootRadius);
+  tipRadius_ = static_cast<GLfloat>(gear.tipRadius);
+
+  // outline segments per tooth, one per profile point
+  const GLint nArcSegments = gear.nArcSegments;
+  const GLint nProfilePoints = static_cast<GLint>(gear.points.size());
+  const GLint hasRadialFlank = gear.hasRadialFlank ? 1 : 0;
+  const GLfloat rootRadius = static_cast<GLfloat>(gear.rootRadius);
+  const GLfloat baseRadius = static_cast<GLfloat>(gear.baseRadius);
+  const GLfloat startAngle = static_cast<GLfloat>(gear.startAngle);
+  const GLfloat tMin = static_cast<GLfloat>(gear.minRollAngle);
+  const GLfloat tMax = static_cast<GLfloat>(gear.maxRollAngle);
+  const GLfloat footAngle = static_cast<GLfloat>(gear.footAngle);
+  const GLfloat tipAngle = static_cast<GLfloat>(gear.tipAngle);
+  const GLfloat rootStep = static_cast<GLfloat>(gear.rootStep);
+  const GLfloat flankStep = static_cast<GLfloat>(gear.flankStep);
+  nElements_ = nTeeth_ * nProfilePoints
+      * (boreRadius_ > 0.f ? VERTICES_PER_SEGMENT : VERTICES_PER_SEGMENT - 6);
+  const GLfloat halfThickness = 0.5f * thickness_;
+  setBoundingBox(glm::vec3(-tipRadius_, -tipRadius_, -halfThickness),
+      glm::vec3(tipRadius_, tipRadius_, halfThickness));
+
+  // write parameters into UBO
+  GLubyte buffer[BUFFER_SIZE];
+  memset(buffer, 0, BUFFER_SIZE);
+  memcpy(buffer + N_TEETH_OFFSET, &nTeeth_, INT_SIZE);
+  memcpy(buffer + N_FLANK_SEGMENTS_OFFSET, &nFlankSegments_, INT_SIZE);
+  memcpy(buffer + N_ARC_SEGMENTS_OFFSET, &nArcSegments, INT_SIZE);
+  memcpy(buffer + N_PROFILE_POINTS_OFFSET, &nProfilePoints, INT_SIZE);
+  memcpy(buffer + HAS_RADIAL_FLANK_OFFSET, &hasRadialFlank, INT_SIZE);
+  memcpy(buffer + ROOT_RADIUS_OFFSET, &rootRadius, FLOAT_SIZE);
+  memcpy(buffer + BASE_RADIUS_OFFSET, &baseRadius, FLOAT_SIZE);
+  memcpy(buffer + TIP_RADIUS_OFFSET, &tipRadius_, FLOAT_SIZE);
+  memcpy(buffer + BORE_RADIUS_OFFSET, &boreRadius_, FLOAT_SIZE);
+  memcpy(buffer + START_ANGLE_OFFSET, &startAngle, FLOAT_SIZE);
+  memcpy(buffer + MIN_ROLL_ANGLE_OFFSET, &tMin, FLOAT_SIZE);
+  memcpy(buffer + MAX_ROLL_ANGLE_OFFSET, &tMax, FLOAT_SIZE);
+  memcpy(buffer + HALF_THICKNESS_OFFSET, &halfThickness, FLOAT_SIZE);
+  memcpy(buffer + FOOT_ANGLE_OFFSET, &footAngle, FLOAT_SIZE);
+  memcpy(buffer + TIP_ANGLE_OFFSET, &tipAngle, FLOAT_SIZE);
+  memcpy(buffer + ROOT_STEP_OFFSET, &rootStep, FLOAT_SIZE);
+  memcpy(buffer + FLANK_STEP_OFFSET, &flankStep, FLOAT_SIZE);
+  glBindBuffer(GL_UNIFORM_BUFFER, ubo_);
+  assert(glIsBuffer(ubo_));
+  glBufferData(GL_UNIFORM_BUFFER, BUFFER_SIZE, buffer, GL_DYNAMIC_DRAW);
+  glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+  assert(!checkGLError());
+}
+
+
+} /* namespace scg */
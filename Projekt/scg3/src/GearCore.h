@@ -0,0 +1,190 @@
+/**
+ * \file GearCore.h
+ * \brief A geometry core that draws an involute spur gear without vertex buffers,
+ *    generating its vertices in the vertex shader.
+ *
+ * \author Projektgruppe "Zahnradapparatus"
+ */
+
+/*
+ * Copyright 2026 Projektgruppe "Zahnradapparatus"
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GEARCORE_H_
+#define GEARCORE_H_
+
+#include "scg_glew.h"
+#include "GeometryCore.h"
+#include "scg_internals.h"
+
+namespace scg {
+
+
+/**
+ * \brief A geometry core that draws an involute spur gear without vertex buffers,
+ *    generating its vertices in the vertex shader.
+ *
+ * The gear has the same shape as GeometryCoreFactory::createGear(), but only its
+ * parameters are stored in a small uniform buffer object (UBO), which is bound in render().
+ * The gear is drawn by glDrawArrays() with an empty vertex array object, and the
+ * vertex shader gear_vert.glsl computes position, normal, and texture coordinates
+ * of each vertex from gl_VertexID. The shader has to be used instead of the standard
+ * vertex shader, e.g., combined with phong_frag.glsl and blinn_phong_lighting.glsl.
+ *
+ * Changing the parameters only rewrites the UBO, such that gears may be resized or
+ * animated without regenerating geometry on the CPU.
+ *
+ * Note: GearCore is not supported by InstancedShape.
+ */
+class GearCore: public GeometryCore {
+
+public:
+
+  /**
+   * Constructor, cf. GeometryCoreFactory::createGear().
+   *
+   * \param nTeeth number of teeth (at least 3)
+   * \param module module, i.e., pitch diameter divided by number of teeth
+   * \param pressureAngleDeg pressure angle (degrees)
+   * \param thickness face width in z direction
+   * \param boreRadius radius of central hole (0 for none, must be less than root radius)
+   * \param nFlankSegments number of line segments per tooth flank
+   */
+  GearCore(int nTeeth, GLfloat module, GLfloat pressureAngleDeg, GLfloat thickness,
+      GLfloat boreRadius, int nFlankSegments);
+
+  /**
+   * Destructor.
+   */
+  virtual ~GearCore();
+
+  /**
+   * Create shared pointer, cf. GeometryCoreFactory::createGear().
+   */
+  static GearCoreSP create(int nTeeth, GLfloat module, GLfloat pressureAngleDeg = 20.f,
+      GLfloat thickness = 1.f, GLfloat boreRadius = 0.f, int nFlankSegments = 4);
+
+  /**
+   * Set number of teeth (at least 3).
+   * \return this pointer for method chaining
+   */
+  GearCore* setNTeeth(int nTeeth);
+
+  /**
+   * Set module, i.e., pitch diameter divided by number of teeth.
+   * \return this pointer for method chaining
+   */
+  GearCore* setModule(GLfloat module);
+
+  /**
+   * Set pressure angle (degrees).
+   * \return this pointer for method chaining
+   */
+  GearCore* setPressureAngle(GLfloat pressureAngleDeg);
+
+  /**
+   * Set face width in z direction.
+   * \return this pointer for method chaining
+   */
+  GearCore* setThickness(GLfloat thickness);
+
+  /**
+   * Set radius of central hole (0 for none, must be less than root radius).
+   * \return this pointer for method chaining
+   */
+  GearCore* setBoreRadius(GLfloat boreRadius);
+
+  /**
+   * Set number of line segments per tooth flank.
+   * \return this pointer for method chaining
+   */
+  GearCore* setNFlankSegments(int nFlankSegments);
+
+  /**
+   * Get number of teeth.
+   */
+  int getNTeeth() const;
+
+  /**
+   * Get module.
+   */
+  GLfloat getModule() const;
+
+  /**
+   * Get tip radius, i.e., outer radius of the gear.
+   */
+  GLfloat getTipRadius() const;
+
+  /**
+   * Render gear, i.e., bind UBO and draw all vertices.
+   */
+  virtual void render(RenderState* renderState);
+
+public:
+
+  // parameters for uniform buffer object (UBO), cf. gear_vert.glsl
+  static const size_t INT_SIZE = 4;
+  static const size_t FLOAT_SIZE = 4;
+  static const size_t N_TEETH_OFFSET = 0;
+  static const size_t N_FLANK_SEGMENTS_OFFSET = 4;
+  static const size_t N_ARC_SEGMENTS_OFFSET = 8;
+  static const size_t N_PROFILE_POINTS_OFFSET = 12;
+  static const size_t HAS_RADIAL_FLANK_OFFSET = 16;
+  static const size_t ROOT_RADIUS_OFFSET = 20;
+  static const size_t BASE_RADIUS_OFFSET = 24;
+  static const size_t TIP_RADIUS_OFFSET = 28;
+  static const size_t BORE_RADIUS_OFFSET = 32;
+  static const size_t START_ANGLE_OFFSET = 36;
+  static const size_t MIN_ROLL_ANGLE_OFFSET = 40;
+  static const size_t MAX_ROLL_ANGLE_OFFSET = 44;
+  static const size_t HALF_THICKNESS_OFFSET = 48;
+  static const size_t FOOT_ANGLE_OFFSET = 52;
+  static const size_t TIP_ANGLE_OFFSET = 56;
+  static const size_t ROOT_STEP_OFFSET = 60;
+  static const size_t FLANK_STEP_OFFSET = 64;
+  static const size_t BUFFER_SIZE = 80;
+
+  /**
+   * Number of vertices per outline segment: two triangles each for front face,
+   * back face, outer wall, and bore wall (omitted without bore).
+   */
+  static const int VERTICES_PER_SEGMENT = 24;
+
+protected:
+
+  /**
+   * Compute profile parameters, vertex count, and bounding box from the gear parameters
+   * and write them into the UBO, called by constructor and setters.
+   */
+  void update_();
+
+protected:
+
+  GLuint ubo_;          // uniform buffer object
+  GLint uboOld_;
+  int nTeeth_;
+  GLfloat module_;
+  GLfloat pressureAngleDeg_;
+  GLfloat thickness_;
+  GLfloat boreRadius_;
+  int nFlankSegments_;
+  GLfloat tipRadius_;
+
+};
+
+
+} /* namespace scg */
+
+#endif /* GEARCORE_H_ */
@@ -0,0 +1,190 @@
+/**
+ * \file GearProfile.h
+ * \brief Tooth profile of an involute spur gear.
+ *
+ * \author Projektgruppe "Zahnradapparatus"
+ */
+
+/*
+ * Copyright 2026 Projektgruppe "Zahnradapparatus"
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GEARPROFILE_H_
+#define GEARPROFILE_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+namespace scg {
+
+
+/**
+ * \brief Tooth profile of an involute spur gear with standard basic rack proportions,
+ *    i.e., the addendum is module and the dedendum is 1.25 * module.
+ *
+ * The right flank of the tooth centered at angle 0 is an involute of the base circle,
+ * parameterized by its roll angle t, which crosses the pitch circle at half the
+ * tooth thickness (PI / 2 * module); the left flank is mirrored. Where the root circle
+ * is smaller than the base circle, the flanks continue radially down to the root circle.
+ * Flanks of pointed teeth (few teeth, large pressure angle) are cut where they meet.
+ *
+ * The profile is computed once per parameter set and replicated for all teeth by
+ * GeometryCoreFactory::createGear(), GearCore (whose vertex shader evaluates the same
+ * parameters), and the ZahnRadModel of the Zahnraeder viewer. It depends on the
+ * standard library only, such that the viewer can include it without linking scg3.
+ */
+struct GearProfile {
+
+  /**
+   * Point of the outline in polar coordinates.
+   */
+  struct Point {
+    double radius;
+    double angle;
+    bool isCorner;    ///< different normals on both sides
+    bool hasSpoke;    ///< connected to the bore circle, i.e., not a base circle point of
+                      ///< a radial flank, which is collinear with its neighbors
+  };
+
+  /**
+   * Constructor, computes radii, roll angle range, and outline of one tooth.
+   *
+   * \param nTeeth0 number of teeth (at least 3)
+   * \param module pitch diameter divided by number of teeth
+   * \param pressureAngleDeg pressure angle (degrees)
+   * \param nFlankSegments0 number of line segments per tooth flank (at least 1)
+   */
+  GearProfile(int nTeeth0, double module, double pressureAngleDeg, int nFlankSegments0);
+
+  /**
+   * Get polar angle of the right flank at roll angle t.
+   */
+  double getFlankAngle(double t) const {
+    return startAngle + t - std::atan(t);
+  }
+
+  /**
+   * Get radius of the right flank at roll angle t.
+   */
+  double getFlankRadius(double t) const {
+    return baseRadius * std::sqrt(1. + t * t);
+  }
+
+  /**
+   * Get roll angle of the involute at the given radius (at least base radius).
+   */
+  double getRollAngle(double radius) const {
+    return std::sqrt(radius * radius / (baseRadius * baseRadius) - 1.);
+  }
+
+  int nTeeth;
+  int nFlankSegments;
+  int nArcSegments;       ///< line segments of root arc and tip arc
+  double pitchRadius;
+  double baseRadius;
+  double rootRadius;
+  double tipRadius;       ///< reduced for pointed teeth
+  bool hasRadialFlank;    ///< root circle inside base circle
+  double startAngle;      ///< flank angle at roll angle 0
+  double minRollAngle;
+  double maxRollAngle;
+  double footAngle;       ///< flank angle at minimum roll angle
+  double tipAngle;        ///< flank angle at maximum roll angle
+  double rootStep;        ///< angle step of root arc
+  double flankStep;       ///< roll angle step of flanks
+
+  /**
+   * Outline of one tooth from angle -PI / nTeeth (inclusive) to PI / nTeeth (exclusive),
+   * counterclockwise: root arc, right flank, tip arc, left flank, root arc.
+   */
+  std::vector<Point> points;
+
+};
+
+
+inline GearProfile::GearProfile(int nTeeth0, double module, double pressureAngleDeg,
+    int nFlankSegments0)
+    : nTeeth(nTeeth0), nFlankSegments(nFlankSegments0) {
+  assert(nTeeth >= 3);
+  assert(nFlankSegments >= 1);
+  const double pi = std::acos(-1.);
+
+  // pitch, base, tip (addendum), and root (dedendum) radius
+  const double pressureAngle = pressureAngleDeg * pi / 180.;
+  pitchRadius = 0.5 * module * nTeeth;
+  baseRadius = pitchRadius * std::cos(pressureAngle);
+  rootRadius = pitchRadius - 1.25 * module;
+  tipRadius = pitchRadius + module;
+
+  // roll angle range of the flanks, cut where the flanks of pointed teeth meet
+  startAngle = -0.5 * pi / nTeeth - (std::tan(pressureAngle) - pressureAngle);
+  hasRadialFlank = rootRadius < baseRadius;
+  minRollAngle = hasRadialFlank ? 0. : getRollAngle(rootRadius);
+  maxRollAngle = getRollAngle(tipRadius);
+  if (getFlankAngle(maxRollAngle) > 0.) {
+    double t0 = minRollAngle;
+    for (int i = 0; i < 48; ++i) {
+      double t = 0.5 * (t0 + maxRollAngle);
+      if (getFlankAngle(t) > 0.) {
+        maxRollAngle = t;
+      }
+      else {
+        t0 = t;
+      }
+    }
+    maxRollAngle = t0;
+    tipRadius = getFlankRadius(maxRollAngle);
+  }
+  nArcSegments = std::max(1, nFlankSegments / 2);
+  footAngle = getFlankAngle(minRollAngle);
+  tipAngle = getFlankAngle(maxRollAngle);
+  rootStep = (pi / nTeeth + footAngle) / nArcSegments;
+  flankStep = (maxRollAngle - minRollAngle) / nFlankSegments;
+
+  // outline of one tooth
+  points.reserve(3 * nArcSegments + 2 * nFlankSegments + 2);
+  for (int i = 0; i < nArcSegments; ++i) {
+    points.push_back({ rootRadius, -pi / nTeeth + i * rootStep, false, true });
+  }
+  if (hasRadialFlank) {
+    points.push_back({ rootRadius, footAngle, true, true });
+  }
+  for (int i = 0; i <= nFlankSegments; ++i) {
+    double t = minRollAngle + i * flankStep;
+    bool isCorner = (i == nFlankSegments) || (i == 0 && !hasRadialFlank);
+    points.push_back({ getFlankRadius(t), getFlankAngle(t), isCorner, i > 0 || !hasRadialFlank });
+  }
+  for (int i = 1; i < nArcSegments; ++i) {
+    points.push_back({ tipRadius, tipAngle - 2. * tipAngle * i / nArcSegments, false, true });
+  }
+  for (int i = nFlankSegments; i >= 0; --i) {
+    double t = minRollAngle + i * flankStep;
+    bool isCorner = (i == nFlankSegments) || (i == 0 && !hasRadialFlank);
+    points.push_back({ getFlankRadius(t), -getFlankAngle(t), isCorner, i > 0 || !hasRadialFlank });
+  }
+  if (hasRadialFlank) {
+    points.push_back({ rootRadius, -footAngle, true, true });
+  }
+  for (int i = 1; i < nArcSegments; ++i) {
+    points.push_back({ rootRadius, -footAngle + i * rootStep, false, true });
+  }
+}
+
+
+} /* namespace scg */
+
+#endif /* GEARPROFILE_H_ */
@@ -0,0 +1,205 @@
+/**
+ * \file GeometryArena.cpp
+ *
+ * \author Projektgruppe "Zahnradapparatus"
+ */
+
+/*
+ * Copyright 2026 Projektgruppe "Zahnradapparatus"
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include "GeometryArena.h"
+#include "GeometryCore.h"
+#include "scg_utilities.h"
+
+namespace scg {
+
+
+GeometryArena::GeometryArena(GLsizeiptr vertexBlockSize, GLsizeiptr indexBlockSize)
+    : vertexBlockSize_(vertexBlockSize), indexBlockSize_(indexBlockSize), drawIDBuffer_(0) {
+  isBufferStorageSupported_ = isGLVersionSupported(4, 4) || isGLExtensionSupported("GL_ARB_buffer_storage");
+  isMultiDrawIndirectSupported_ = isMultiDrawIndirectSupported();
+  if (isMultiDrawIndirectSupported_) {
+    // draw IDs are fetched by base instance of indirect draw commands
+    std::vector<GLfloat> drawIDs(MAX_DRAW_IDS);
+    for (GLsizei i = 0; i < MAX_DRAW_IDS; ++i) {
+      drawIDs[i] = static_cast<GLfloat>(i);
+    }
+    drawIDBuffer_ = createBuffer_(GL_ARRAY_BUFFER, MAX_DRAW_IDS * sizeof(GLfloat), drawIDs.data());
+  }
+
+  assert(!checkGLError());
+}
+
+
+GeometryArena::~GeometryArena() {
+  if (isGLContextActive()) {
+    for (auto& block : blocks_) {
+      glDeleteVertexArrays(1, &block.vao);
+      glDeleteBuffers(1, &block.vbo);
+      glDeleteBuffers(1, &block.ibo);
+    }
+    glDeleteBuffers(1, &drawIDBuffer_);
+  }
+}
+
+
+GeometryArenaSP GeometryArena::create(GLsizeiptr vertexBlockSize, GLsizeiptr indexBlockSize) {
+  return std::make_shared<GeometryArena>(vertexBlockSize, indexBlockSize);
+}
+
+
+GeometryArena::Allocation GeometryArena::allocate(const VertexLayout& layout,
+    const GLvoid* vertexData, GLsizei nVertices, const GLuint* indices, GLsizei nIndices) {
+  return allocate(layout, vertexData, nVertices, indices, GL_UNSIGNED_INT, nIndices);
+}
+
+
+GeometryArena::Allocation GeometryArena::allocate(const VertexLayout& layout,
+    const GLvoid* vertexData, GLsizei nVertices, const GLvoid* indices, GLenum dataIndexType,
+    GLsizei nIndices) {
+  assert(layout.getStride() > 0);
+  const GLenum indexType = (nVertices <= 0x10000) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+  const GLsizei indexSize = GeometryCore::getIndexSize(indexType);
+
+  // find block with same layout and index type and enough space, or create new one
+  Block* block = nullptr;
+  for (auto& candidate : blocks_) {
+    if (candidate.layout == layout && candidate.indexType == indexType
+        && candidate.nVertices + nVertices <= candidate.vertexCapacity
+        && candidate.nIndices + nIndices <= candidate.indexCapacity) {
+      block = &candidate;
+      break;
+    }
+  }
+  if (!block) {
+    const GLsizei vertexCapacity = std::max(nVertices,
+        static_cast<GLsizei>(vertexBlockSize_ / layout.getStride()));
+    const GLsizei indexCapacity = std::max(nIndices,
+        static_cast<GLsizei>(indexBlockSize_ / indexSize));
+    createBlock_(layout, indexType, vertexCapacity, indexCapacity);
+    block = &blocks_.back();
+  }
+
+  // copy data behind previous allocations, indices remain relative to the base vertex
+  Allocation result;
+  result.vao = block->vao;
+  result.baseVertex = block->nVertices;
+  result.firstIndex = static_cast<GLuint>(block->nIndices);
+  result.indexType = indexType;
+  glBindBuffer(GL_COPY_WRITE_BUFFER, block->vbo);
+  glBufferSubData(GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(block->nVertices) * layout.getStride(),
+      static_cast<GLsizeiptr>(nVertices) * layout.getStride(), vertexData);
+  std::vector<GLubyte> indexData;
+  if (dataIndexType != indexType) {
+    std::vector<GLuint> unpacked(nIndices);
+    GeometryCore::unpackIndices(indices, nIndices, dataIndexType, unpacked.data());
+    indexData.resize(static_cast<size_t>(nIndices) * indexSize);
+    GeometryCore::packIndices(unpacked.data(), nIndices, indexType, indexData.data());
+    indices = indexData.data();
+  }
+  glBindBuffer(GL_COPY_WRITE_BUFFER, block->ibo);
+  glBufferSubData(GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(block->nIndices) * indexSize,
+      static_cast<GLsizeiptr>(nIndices) * indexSize, indices);
+  glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+  block->nVertices += nVertices;
+  block->nIndices += nIndices;
+
+  assert(!checkGLError());
+  return result;
+}
+
+
+int GeometryArena::getNBlocks() const {
+  return static_cast<int>(blocks_.size());
+}
+
+
+GLsizeiptr GeometryArena::getAllocatedSize() const {
+  GLsizeiptr result = 0;
+  for (auto& block : blocks_) {
+    result += static_cast<GLsizeiptr>(block.nVertices) * block.layout.getStride()
+        + static_cast<GLsizeiptr>(block.nIndices) * GeometryCore::getIndexSize(block.indexType);
+  }
+  return result;
+}
+
+
+bool GeometryArena::isMultiDrawIndirectSupported() {
+  // base instances are core in OpenGL 4.2, multi-draw indirect in OpenGL 4.3
+  return isGLVersionSupported(4, 3);
+}
+
+
+void GeometryArena::createBlock_(const VertexLayout& layout, GLenum indexType,
+    GLsizei vertexCapacity, GLsizei indexCapacity) {
+  Block block;
+  block.layout = layout;
+  block.indexType = indexType;
+  block.vertexCapacity = vertexCapacity;
+  block.indexCapacity = indexCapacity;
+  block.nVertices = 0;
+  block.nIndices = 0;
+  block.vbo = createBuffer_(GL_ARRAY_BUFFER,
+      static_cast<GLsizeiptr>(vertexCapacity) * layout.getStride(), nullptr);
+  block.ibo = createBuffer_(GL_ARRAY_BUFFER,
+      static_cast<GLsizeiptr>(indexCapacity) * GeometryCore::getIndexSize(indexType), nullptr);
+
+  // vertex array object with attribute pointers and element buffer
+  glGenVertexArrays(1, &block.vao);
+  glBindVertexArray(block.vao);
+  assert(glIsVertexArray(block.vao));
+  glBindBuffer(GL_ARRAY_BUFFER, block.vbo);
+  for (auto& attribute : layout.getAttributes()) {
+    glVertexAttribPointer(attribute.location, attribute.dim, attribute.type, attribute.isNormalized,
+        layout.getStride(), reinterpret_cast<const GLvoid*>(static_cast<size_t>(attribute.offset)));
+    glEnableVertexAttribArray(attribute.location);
+  }
+  if (drawIDBuffer_) {
+    glBindBuffer(GL_ARRAY_BUFFER, drawIDBuffer_);
+    glVertexAttribPointer(OGLConstants::DRAW_ID.location, 1, GL_FLOAT, GL_FALSE, 0,
+        static_cast<const GLvoid*>(0));
+    glVertexAttribDivisor(OGLConstants::DRAW_ID.location, 1);
+    glEnableVertexAttribArray(OGLConstants::DRAW_ID.location);
+  }
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, block.ibo);
+  glBindVertexArray(0);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  blocks_.push_back(block);
+
+  assert(!checkGLError());
+}
+
+
+GLuint GeometryArena::createBuffer_(GLenum target, GLsizeiptr size, const GLvoid* data) const {
+  GLuint buffer = 0;
+  glGenBuffers(1, &buffer);
+  glBindBuffer(target, buffer);
+  assert(glIsBuffer(buffer));
+  if (isBufferStorageSupported_) {
+    glBufferStorage(target, size, data, GL_DYNAMIC_STORAGE_BIT);
+  }
+  else {
+    glBufferData(target, size, data, GL_STATIC_DRAW);
+  }
+  glBindBuffer(target, 0);
+  return buffer;
+}
+
+
+} /* namespace scg */
@@ -0,0 +1,200 @@
+/**
+ * \file GeometryArena.h
+ * \brief Large shared vertex and index buffers that store the geometry of many geometry cores.
+ *
+ * \author Projektgruppe "Zahnradapparatus"
+ */
+
+/*
+ * Copyright 2026 Projektgruppe "Zahnradapparatus"
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GEOMETRYARENA_H_
+#define GEOMETRYARENA_H_
+
+#include <vector>
+#include "scg_glew.h"
+#include "scg_internals.h"
+#include "VertexLayout.h"
+
+namespace scg {
+
+
+/**
+ * \brief Indirect draw command, as read by glMultiDrawElementsIndirect().
+ */
+struct DrawElementsIndirectCommand {
+  GLuint count;
+  GLuint instanceCount;
+  GLuint firstIndex;
+  GLint baseVertex;
+  GLuint baseInstance;
+};
+
+
+/**
+ * \brief Large shared vertex and index buffers that store the geometry of many geometry cores.
+ *
+ * Vertex and index ranges are suballocated from blocks of fixed size, which are created
+ * on demand. Each block contains vertices of one vertex layout and indices of one index type
+ * only and has its own vertex array object (VAO), such that all geometry cores of the same
+ * layout and index type share one VAO and may be drawn by one glMultiDrawElementsIndirect()
+ * call (cf. DrawBatcher).
+ *
+ * Since indices are relative to the base vertex of each geometry core, meshes with less
+ * than 65,536 vertices are stored with 16-bit indices. 8-bit indices are not used, to avoid
+ * splitting small meshes into separate blocks.
+ *
+ * Buffers are never resized. With OpenGL 4.4 they are created as immutable storage.
+ * Allocated ranges are not reused when geometry cores are destroyed, i.e., an arena
+ * is meant for static scenes and is released as a whole.
+ *
+ * If indirect drawing is supported (OpenGL 4.3), each VAO additionally provides the draw ID
+ * attribute (OGLConstants::DRAW_ID) as instanced attribute, such that the base instance
+ * of a draw command selects its per-draw data.
+ */
+class GeometryArena {
+
+public:
+
+  /**
+   * Range of a geometry core within an arena.
+   */
+  struct Allocation {
+    GLuint vao;
+    GLint baseVertex;
+    GLuint firstIndex;
+    GLenum indexType;
+  };
+
+  /**
+   * Constructor.
+   *
+   * \param vertexBlockSize size of vertex buffers in bytes (larger meshes get their own block)
+   * \param indexBlockSize size of index buffers in bytes (larger meshes get their own block)
+   */
+  GeometryArena(GLsizeiptr vertexBlockSize = DEFAULT_VERTEX_BLOCK_SIZE,
+      GLsizeiptr indexBlockSize = DEFAULT_INDEX_BLOCK_SIZE);
+
+  /**
+   * Destructor.
+   */
+  virtual ~GeometryArena();
+
+  /**
+   * Create shared pointer.
+   */
+  static GeometryArenaSP create(GLsizeiptr vertexBlockSize = DEFAULT_VERTEX_BLOCK_SIZE,
+      GLsizeiptr indexBlockSize = DEFAULT_INDEX_BLOCK_SIZE);
+
+  /**
+   * Copy vertex and index data into a block of the given vertex layout and the
+   * smallest index type (GL_UNSIGNED_SHORT or GL_UNSIGNED_INT) that fits the indices.
+   *
+   * \param layout vertex layout of vertexData
+   * \param vertexData interleaved vertex data, layout.getStride() bytes per vertex
+   * \param nVertices number of vertices
+   * \param indices element indices, relative to the first vertex
+   * \param nIndices number of indices
+   * \return VAO and offsets to be used for drawing
+   */
+  Allocation allocate(const VertexLayout& layout, const GLvoid* vertexData, GLsizei nVertices,
+      const GLuint* indices, GLsizei nIndices);
+
+  /**
+   * Copy vertex data and element indices of the given type into a block, cf. allocate().
+   * Indices of the block's index type are copied without conversion.
+   *
+   * \param indexType GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT, or GL_UNSIGNED_INT
+   */
+  Allocation allocate(const VertexLayout& layout, const GLvoid* vertexData, GLsizei nVertices,
+      const GLvoid* indices, GLenum indexType, GLsizei nIndices);
+
+  /**
+   * Get number of blocks, i.e., of vertex array objects.
+   */
+  int getNBlocks() const;
+
+  /**
+   * Get total size of allocated vertex and index data in bytes.
+   */
+  GLsizeiptr getAllocatedSize() const;
+
+  /**
+   * Check if the current OpenGL context supports glMultiDrawElementsIndirect()
+   * with base instances (OpenGL 4.3).
+   */
+  static bool isMultiDrawIndirectSupported();
+
+public:
+
+  static const GLsizeiptr DEFAULT_VERTEX_BLOCK_SIZE = 16 << 20;
+  static const GLsizeiptr DEFAULT_INDEX_BLOCK_SIZE = 8 << 20;
+
+  /**
+   * Maximum number of draws per batch, i.e., number of draw IDs provided by the VAOs.
+   */
+  static const GLsizei MAX_DRAW_IDS = 8192;
+
+protected:
+
+  /**
+   * A vertex and an index buffer with their VAO.
+   */
+  struct Block {
+    VertexLayout layout;
+    GLenum indexType;
+    GLuint vao;
+    GLuint vbo;
+    GLuint ibo;
+    GLsizei vertexCapacity;
+    GLsizei indexCapacity;
+    GLsizei nVertices;
+    GLsizei nIndices;
+  };
+
+  /**
+   * Create block with the given capacities and set up its VAO.
+   */
+  void createBlock_(const VertexLayout& layout, GLenum indexType, GLsizei vertexCapacity,
+      GLsizei indexCapacity);
+
+  /**
+   * Create buffer of fixed size, as immutable storage if supported.
+   */
+  GLuint createBuffer_(GLenum target, GLsizeiptr size, const GLvoid* data) const;
+
+protected:
+
+  GLsizeiptr vertexBlockSize_;
+  GLsizeiptr indexBlockSize_;
+  std::vector<Block> blocks_;
+  GLuint drawIDBuffer_;
+  bool isBufferStorageSupported_;
+  bool isMultiDrawIndirectSupported_;
+
+private:
+
+  /**
+   * Disallow copy constructor and assignment operator.
+   */
+  SCG_DISALLOW_COPY_AND_ASSIGN(GeometryArena);
+
+};
+
+
+} /* namespace scg */
+
+#endif /* GEOMETRYARENA_H_ */
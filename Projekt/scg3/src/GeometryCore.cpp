@@ -21,24 +21,94 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <cassert>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
 #include "GeometryCore.h"
+#include "Node.h"
 #include "RenderState.h"
 #include "scg_utilities.h"
 
 namespace scg {
 
 
+/**
+ * Convert one vertex attribute component to float, as done by vertex fetch.
+ *
+ * \return false if type is not supported
+ */
+static bool decodeComponent(const GLubyte* data, GLenum type, GLboolean isNormalized,
+    GLfloat& value) {
+  switch (type) {
+  case GL_FLOAT:
+    memcpy(&value, data, sizeof(GLfloat));
+    break;
+  case GL_HALF_FLOAT: {
+    GLushort half;
+    memcpy(&half, data, sizeof(GLushort));
+    value = glm::unpackHalf1x16(half);
+    break;
+  }
+  case GL_UNSIGNED_SHORT: {
+    GLushort component;
+    memcpy(&component, data, sizeof(GLushort));
+    value = isNormalized ? component / 65535.f : component;
+    break;
+  }
+  case GL_SHORT: {
+    GLshort component;
+    memcpy(&component, data, sizeof(GLshort));
+    value = isNormalized ? std::max(component / 32767.f, -1.f) : component;
+    break;
+  }
+  case GL_UNSIGNED_BYTE:
+    value = isNormalized ? *data / 255.f : *data;
+    break;
+  case GL_BYTE: {
+    const GLbyte component = static_cast<GLbyte>(*data);
+    value = isNormalized ? std::max(component / 127.f, -1.f) : component;
+    break;
+  }
+  default:
+    return false;
+  }
+  return true;
+}
+
+
 GeometryCore::GeometryCore(GLenum primitiveType, DrawMode drawMode)
     : primitiveType_(primitiveType), drawMode_(drawMode), vao_(0),
-      vboIndex_(0), nElements_(0) {
+      vboIndex_(0), arenaVAO_(0), nStreamVertices_(0), baseVertex_(0), firstIndex_(0),
+      indexType_(GL_UNSIGNED_INT),
+      nElements_(0), attributeDataSize_(0), hasVertexTransform_(false),
+      vertexTransform_(1.f), lodThreshold_(1.f), lodLevel_(0),
+      boundsMin_(FLT_MAX), boundsMax_(-FLT_MAX), boundsRadius_(0.f), isBoundingBoxSet_(false) {
   switch(drawMode_) {
   case DrawMode::ARRAYS:
-    drawFunc_ = std::bind(&glDrawArrays, std::placeholders::_1, 0, std::placeholders::_2);
+    // base vertex is non-zero for vertices stored in a stream buffer
+    drawFunc_ = [this](GLenum mode, GLint first, GLsizei count, GLsizei nInstances) {
+      if (nInstances == 1) {
+        glDrawArrays(mode, baseVertex_ + first, count);
+      }
+      else {
+        glDrawArraysInstanced(mode, baseVertex_ + first, count, nInstances);
+      }
+    };
     break;
   case DrawMode::ELEMENTS:
-    drawFunc_ = std::bind(&glDrawElements, std::placeholders::_1, std::placeholders::_2,
-        GL_UNSIGNED_INT, static_cast<const GLvoid*>(nullptr));
+    // base vertex and first index are non-zero for geometry stored in an arena or stream buffer
+    // (non-const offset pointer, since older GLEW versions declare it as void*)
+    drawFunc_ = [this](GLenum mode, GLint first, GLsizei count, GLsizei nInstances) {
+      GLvoid* offset = reinterpret_cast<GLvoid*>((firstIndex_ + first) * getIndexSize(indexType_));
+      if (nInstances == 1) {
+        glDrawElementsBaseVertex(mode, count, indexType_, offset, baseVertex_);
+      }
+      else {
+        glDrawElementsInstancedBaseVertex(mode, count, indexType_, offset, nInstances, baseVertex_);
+      }
+    };
     break;
   default:
     assert(!"Unknown drawMode [GeometryCore::GeometryCore()]");
@@ -67,6 +137,12 @@ GeometryCoreSP GeometryCore::create(GLenum primitiveType, DrawMode drawMode) {
 
 
 GeometryCore* GeometryCore::addAttributeData(GLuint location, const GLfloat* data, GLsizeiptr size, GLint dim, GLenum usage) {
+  return addAttributeData(location, data, size, dim, GL_FLOAT, GL_FALSE, usage);
+}
+
+
+GeometryCore* GeometryCore::addAttributeData(GLuint location, const GLvoid* data, GLsizeiptr size,
+    GLint dim, GLenum type, GLboolean isNormalized, GLenum usage) {
   glBindVertexArray(vao_);
   assert(glIsVertexArray(vao_));
   GLuint vbo = 0;
@@ -75,10 +151,16 @@ GeometryCore* GeometryCore::addAttributeData(GLuint location, const GLfloat* dat
   assert(glIsBuffer(vbo));
   vboAttributes_.push_back(vbo);
   glBufferData(GL_ARRAY_BUFFER, size, data, usage);
+  attributeDataSize_ += size;
+  const GLsizei attributeSize = VertexLayout::getAttributeSize(dim, type);
   if (drawMode_ == DrawMode::ARRAYS && nElements_ == 0) {
-    nElements_ = size / (dim * sizeof(GLfloat));
+    nElements_ = static_cast<GLsizei>(size / attributeSize);
+  }
+  if (location == OGLConstants::VERTEX.location) {
+    updateBounds_(data, attributeSize, static_cast<GLsizei>(size / attributeSize), dim, type,
+        isNormalized);
   }
-  glVertexAttribPointer(location, dim, GL_FLOAT, GL_FALSE, 0, static_cast<const GLvoid*>(0));
+  glVertexAttribPointer(location, dim, type, isNormalized, 0, static_cast<const GLvoid*>(0));
   glEnableVertexAttribArray(location);
   glBindBuffer(GL_ARRAY_BUFFER, 0);
   glBindVertexArray(0);
@@ -88,15 +170,72 @@ GeometryCore* GeometryCore::addAttributeData(GLuint location, const GLfloat* dat
 }
 
 
+GeometryCore* GeometryCore::addVertexData(const VertexLayout& layout, const GLvoid* data,
+    GLsizeiptr size, GLenum usage) {
+  assert(layout.getStride() > 0);
+  glBindVertexArray(vao_);
+  assert(glIsVertexArray(vao_));
+  GLuint vbo = 0;
+  glGenBuffers(1, &vbo);
+  glBindBuffer(GL_ARRAY_BUFFER, vbo);
+  assert(glIsBuffer(vbo));
+  vboAttributes_.push_back(vbo);
+  glBufferData(GL_ARRAY_BUFFER, size, data, usage);
+  attributeDataSize_ += size;
+  if (drawMode_ == DrawMode::ARRAYS && nElements_ == 0) {
+    nElements_ = static_cast<GLsizei>(size / layout.getStride());
+  }
+  for (auto& attribute : layout.getAttributes()) {
+    glVertexAttribPointer(attribute.location, attribute.dim, attribute.type, attribute.isNormalized,
+        layout.getStride(), reinterpret_cast<const GLvoid*>(static_cast<size_t>(attribute.offset)));
+    glEnableVertexAttribArray(attribute.location);
+    if (attribute.location == OGLConstants::VERTEX.location && data) {
+      updateBounds_(static_cast<const GLubyte*>(data) + attribute.offset, layout.getStride(),
+          static_cast<GLsizei>(size / layout.getStride()), attribute.dim, attribute.type,
+          attribute.isNormalized);
+    }
+  }
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glBindVertexArray(0);
+
+  assert(!checkGLError());
+  return this;
+}
+
+
 GeometryCore* GeometryCore::setElementIndexData(const GLuint* data, GLsizeiptr size, GLenum usage) {
+  const GLsizei nIndices = static_cast<GLsizei>(size / sizeof(GLuint));
+  const GLenum indexType = getMinIndexType(nIndices > 0 ? *std::max_element(data, data + nIndices) : 0);
+  std::vector<GLubyte> indexData(nIndices * getIndexSize(indexType));
+  packIndices(data, nIndices, indexType, indexData.data());
+  return setElementIndexData(indexData.data(), indexType, nIndices, usage);
+}
+
+
+GeometryCore* GeometryCore::setElementIndexData(const GLushort* data, GLsizeiptr size, GLenum usage) {
+  std::vector<GLuint> indices(data, data + size / sizeof(GLushort));
+  return setElementIndexData(indices.data(), indices.size() * sizeof(GLuint), usage);
+}
+
+
+GeometryCore* GeometryCore::setElementIndexData(const GLubyte* data, GLsizeiptr size, GLenum usage) {
+  std::vector<GLuint> indices(data, data + size);
+  return setElementIndexData(indices.data(), indices.size() * sizeof(GLuint), usage);
+}
+
+
+GeometryCore* GeometryCore::setElementIndexData(const GLvoid* data, GLenum indexType,
+    GLsizei nIndices, GLenum usage) {
+  indexType_ = indexType;
   glBindVertexArray(vao_);
   assert(glIsVertexArray(vao_));
   glGenBuffers(1, &vboIndex_);
   glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, vboIndex_);
   assert(glIsBuffer(vboIndex_));
-  glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, data, usage);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(nIndices) * getIndexSize(indexType),
+      data, usage);
   if (drawMode_ == DrawMode::ELEMENTS) {
-    nElements_ = size / sizeof(GLuint);
+    nElements_ = nIndices;
   }
   // Note: GL_ELEMENT_ARRAY_BUFFER has to be kept bound
   glBindVertexArray(0);
@@ -106,15 +245,194 @@ GeometryCore* GeometryCore::setElementIndexData(const GLuint* data, GLsizeiptr s
 }
 
 
+GLenum GeometryCore::getIndexType() const {
+  return indexType_;
+}
+
+
+GLsizeiptr GeometryCore::getIndexDataSize() const {
+  return (vboIndex_ || arena_) ? static_cast<GLsizeiptr>(nElements_) * getIndexSize(indexType_) : 0;
+}
+
+
+GeometryCore* GeometryCore::setStreamVertexData(const VertexLayout& layout, GLsizei nVertices,
+    int nRegions) {
+  assert(layout.getStride() > 0 && nVertices > 0);
+  assert(!arena_ && !streamBuffer_);
+  streamBuffer_ = StreamBuffer::create(static_cast<GLsizeiptr>(nVertices) * layout.getStride(),
+      nRegions);
+  nStreamVertices_ = nVertices;
+  attributeDataSize_ += streamBuffer_->getRegionSize() * nRegions;
+  if (drawMode_ == DrawMode::ARRAYS && nElements_ == 0) {
+    nElements_ = nVertices;
+  }
+
+  // regions are consecutive copies of the vertices, selected by the base vertex
+  glBindVertexArray(vao_);
+  assert(glIsVertexArray(vao_));
+  glBindBuffer(GL_ARRAY_BUFFER, streamBuffer_->getBuffer());
+  for (auto& attribute : layout.getAttributes()) {
+    glVertexAttribPointer(attribute.location, attribute.dim, attribute.type, attribute.isNormalized,
+        layout.getStride(), reinterpret_cast<const GLvoid*>(static_cast<size_t>(attribute.offset)));
+    glEnableVertexAttribArray(attribute.location);
+  }
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glBindVertexArray(0);
+
+  assert(!checkGLError());
+  return this;
+}
+
+
+GLvoid* GeometryCore::mapVertexData() {
+  assert(streamBuffer_);
+  return streamBuffer_->map();
+}
+
+
+void GeometryCore::unmapVertexData() {
+  assert(streamBuffer_);
+  streamBuffer_->unmap();
+  baseVertex_ = streamBuffer_->getRegion() * nStreamVertices_;
+}
+
+
+GeometryCore* GeometryCore::updateVertexData(const GLvoid* data, GLsizeiptr size) {
+  assert(streamBuffer_);
+  assert(size <= streamBuffer_->getRegionSize());
+  memcpy(mapVertexData(), data, static_cast<size_t>(size));
+  unmapVertexData();
+  return this;
+}
+
+
+GeometryCore* GeometryCore::setArenaData(GeometryArenaSP arena, const VertexLayout& layout,
+    const GLvoid* vertexData, GLsizei nVertices, const GLuint* indices, GLsizei nIndices) {
+  return setArenaData(arena, layout, vertexData, nVertices, indices, GL_UNSIGNED_INT, nIndices);
+}
+
+
+GeometryCore* GeometryCore::setArenaData(GeometryArenaSP arena, const VertexLayout& layout,
+    const GLvoid* vertexData, GLsizei nVertices, const GLvoid* indices, GLenum indexType,
+    GLsizei nIndices) {
+  assert(drawMode_ == DrawMode::ELEMENTS);
+  assert(!arena_ && !streamBuffer_);
+  GeometryArena::Allocation allocation = arena->allocate(layout, vertexData, nVertices,
+      indices, indexType, nIndices);
+  arena_ = arena;
+  arenaVAO_ = allocation.vao;
+  baseVertex_ = allocation.baseVertex;
+  firstIndex_ = allocation.firstIndex;
+  indexType_ = allocation.indexType;
+  nElements_ = nIndices;
+  attributeDataSize_ += static_cast<GLsizeiptr>(nVertices) * layout.getStride();
+  for (auto& attribute : layout.getAttributes()) {
+    if (attribute.location == OGLConstants::VERTEX.location) {
+      updateBounds_(static_cast<const GLubyte*>(vertexData) + attribute.offset, layout.getStride(),
+          nVertices, attribute.dim, attribute.type, attribute.isNormalized);
+    }
+  }
+  return this;
+}
+
+
+GeometryCore* GeometryCore::setVertexTransform(const glm::mat4& matrix) {
+  vertexTransform_ = matrix;
+  hasVertexTransform_ = (matrix != glm::mat4(1.f));
+  Node::invalidateAllBoundingBoxes();
+  return this;
+}
+
+
+GLsizeiptr GeometryCore::getAttributeDataSize() const {
+  return attributeDataSize_;
+}
+
+
+GeometryCore* GeometryCore::addDrawRange(GLint first, GLsizei count, const std::vector<CoreSP>& cores) {
+  DrawRange range;
+  range.first = first;
+  range.count = count;
+  range.cores = cores;
+  drawRanges_.push_back(range);
+  return this;
+}
+
+
+GeometryCore* GeometryCore::addLODLevel(GLint first, GLsizei count, GLfloat error,
+    const std::vector<GLsizei>& rangeCounts) {
+  assert(lodLevels_.empty() || error >= lodLevels_.back().error);
+  LODLevel level;
+  level.first = first;
+  level.count = count;
+  level.error = error;
+  level.rangeCounts = rangeCounts;
+  lodLevels_.push_back(level);
+  return this;
+}
+
+
+GeometryCore* GeometryCore::setLODThreshold(GLfloat pixels) {
+  lodThreshold_ = pixels;
+  return this;
+}
+
+
+int GeometryCore::getNLODLevels() const {
+  return static_cast<int>(lodLevels_.size());
+}
+
+
+int GeometryCore::getLODLevel() const {
+  return lodLevel_;
+}
+
+
+GeometryCore* GeometryCore::setBoundingBox(const glm::vec3& boundsMin, const glm::vec3& boundsMax,
+    GLfloat boundsRadius) {
+  boundsMin_ = boundsMin;
+  boundsMax_ = boundsMax;
+  boundsRadius_ = (boundsRadius < 0.f) ? 0.5f * glm::length(boundsMax_ - boundsMin_) : boundsRadius;
+  isBoundingBoxSet_ = true;
+  Node::invalidateAllBoundingBoxes();
+  return this;
+}
+
+
+BoundingBox GeometryCore::getBoundingBox() const {
+  if (boundsMin_.x > boundsMax_.x) {
+    return BoundingBox::createInfinite();
+  }
+  BoundingBox result(boundsMin_, boundsMax_);
+  return hasVertexTransform_ ? result.transform(vertexTransform_) : result;
+}
+
+
+bool GeometryCore::getBoundingSphere(glm::vec3& center, GLfloat& radius) const {
+  if (boundsMin_.x > boundsMax_.x) {
+    return false;
+  }
+
+  // scale radius by the largest scale factor of the vertex transform
+  center = glm::vec3(vertexTransform_ * glm::vec4(0.5f * (boundsMin_ + boundsMax_), 1.f));
+  const GLfloat scale = std::sqrt(std::max(glm::dot(vertexTransform_[0], vertexTransform_[0]),
+      std::max(glm::dot(vertexTransform_[1], vertexTransform_[1]),
+      glm::dot(vertexTransform_[2], vertexTransform_[2]))));
+  radius = scale * boundsRadius_;
+  return true;
+}
+
+
 int GeometryCore::getNTriangles() const {
+  const GLsizei nElements = lodLevels_.empty() ? nElements_ : lodLevels_[lodLevel_].count;
   int result;
   switch (primitiveType_) {
   case GL_TRIANGLES:
-    result = nElements_ / 3;
+    result = nElements / 3;
     break;
   case GL_TRIANGLE_FAN:
   case GL_TRIANGLE_STRIP:
-    result = nElements_ - 2;
+    result = nElements - 2;
     break;
   default:
     result = 0;
@@ -125,18 +443,298 @@ int GeometryCore::getNTriangles() const {
 
 
 void GeometryCore::render(RenderState* renderState) {
+  draw_(renderState, 1, true);
+}
+
+
+void GeometryCore::renderInstances(RenderState* renderState, GLsizei nInstances) {
+  if (nInstances > 0) {
+    draw_(renderState, nInstances, false);
+  }
+}
+
+
+bool GeometryCore::computeBounds(const GLvoid* data, GLsizei stride, GLsizei nVertices, GLint dim,
+    GLenum type, GLboolean isNormalized, glm::vec3& boundsMin, glm::vec3& boundsMax,
+    GLfloat& boundsRadius) {
+  if (!data || nVertices <= 0) {
+    return false;
+  }
+
+  // decode positions, missing coordinates are 0
+  std::vector<glm::vec3> positions(nVertices, glm::vec3(0.f));
+  const GLsizei componentSize = VertexLayout::getAttributeSize(1, type);
+  const GLubyte* vertex = static_cast<const GLubyte*>(data);
+  for (GLsizei i = 0; i < nVertices; ++i, vertex += stride) {
+    for (GLint k = 0; k < std::min(dim, 3); ++k) {
+      if (!decodeComponent(vertex + k * componentSize, type, isNormalized, positions[i][k])) {
+        return false;
+      }
+    }
+  }
+
+  // sphere is centered at box center
+  boundsMin = glm::vec3(FLT_MAX);
+  boundsMax = glm::vec3(-FLT_MAX);
+  for (auto& position : positions) {
+    boundsMin = glm::min(boundsMin, position);
+    boundsMax = glm::max(boundsMax, position);
+  }
+  const glm::vec3 center = 0.5f * (boundsMin + boundsMax);
+  boundsRadius = 0.f;
+  for (auto& position : positions) {
+    boundsRadius = std::max(boundsRadius, glm::length(position - center));
+  }
+  return true;
+}
+
+
+void GeometryCore::updateBounds_(const GLvoid* data, GLsizei stride, GLsizei nVertices,
+    GLint dim, GLenum type, GLboolean isNormalized) {
+  glm::vec3 boundsMin, boundsMax;
+  GLfloat boundsRadius;
+  if (isBoundingBoxSet_
+      || !computeBounds(data, stride, nVertices, dim, type, isNormalized, boundsMin, boundsMax,
+          boundsRadius)) {
+    return;
+  }
+
+  // extend box, sphere is centered at box center and contains previous sphere (if any)
+  if (boundsMin_.x <= boundsMax_.x) {
+    const glm::vec3 prevCenter = 0.5f * (boundsMin_ + boundsMax_);
+    const glm::vec3 newCenter = 0.5f * (boundsMin + boundsMax);
+    boundsMin_ = glm::min(boundsMin_, boundsMin);
+    boundsMax_ = glm::max(boundsMax_, boundsMax);
+    const glm::vec3 center = 0.5f * (boundsMin_ + boundsMax_);
+    boundsRadius_ = std::max(boundsRadius_ + glm::length(prevCenter - center),
+        boundsRadius + glm::length(newCenter - center));
+  }
+  else {
+    boundsMin_ = boundsMin;
+    boundsMax_ = boundsMax;
+    boundsRadius_ = boundsRadius;
+  }
+  Node::invalidateAllBoundingBoxes();
+}
+
+
+void GeometryCore::draw_(RenderState* renderState, GLsizei nInstances,
+    bool isVertexTransformApplied) {
+  // select level of detail
+  GLint first = 0;
+  GLsizei count = nElements_;
+  const std::vector<GLsizei>* rangeCounts = nullptr;
+  if (!lodLevels_.empty()) {
+    lodLevel_ = selectLODLevel_(renderState);
+    const LODLevel& level = lodLevels_[lodLevel_];
+    first = level.first;
+    count = level.count;
+    if (level.rangeCounts.size() == drawRanges_.size()) {
+      rangeCounts = &level.rangeCounts;
+    }
+  }
+
   // pass matrices and other state variables to shader
+  const bool hasVertexTransform = hasVertexTransform_ && isVertexTransformApplied;
+  if (hasVertexTransform) {
+    renderState->modelViewStack.pushMatrix();
+    renderState->modelViewStack.multMatrix(vertexTransform_);
+  }
   renderState->passToShader();
 
   // draw primitives
-  glBindVertexArray(vao_);
-  assert(glIsVertexArray(vao_));
+  glBindVertexArray(getVAO());
+  assert(glIsVertexArray(getVAO()));
   assert(drawFunc_ != nullptr);
-  drawFunc_(primitiveType_, nElements_);
+  if (drawRanges_.empty() || (!lodLevels_.empty() && !rangeCounts)) {
+    drawFunc_(primitiveType_, first, count, nInstances);
+  }
+  else {
+    // cores may modify shader state (e.g., texture matrix), which is restored afterwards
+    bool isStateModified = false;
+    GLint rangeFirst = first;
+    for (size_t i = 0; i < drawRanges_.size(); ++i) {
+      const DrawRange& range = drawRanges_[i];
+      for (auto& core : range.cores) {
+        core->render(renderState);
+      }
+      if (isStateModified || !range.cores.empty()) {
+        renderState->passToShader();
+      }
+      if (rangeCounts) {
+        drawFunc_(primitiveType_, rangeFirst, (*rangeCounts)[i], nInstances);
+        rangeFirst += (*rangeCounts)[i];
+      }
+      else {
+        drawFunc_(primitiveType_, range.first, range.count, nInstances);
+      }
+      for (auto rit = range.cores.rbegin(); rit != range.cores.rend(); ++rit) {
+        (*rit)->renderPost(renderState);
+      }
+      isStateModified = !range.cores.empty();
+    }
+  }
   glBindVertexArray(0);
+  if (streamBuffer_) {
+    streamBuffer_->lock();
+  }
+  if (hasVertexTransform) {
+    renderState->modelViewStack.popMatrix();
+  }
 
   assert(!checkGLError());
 }
 
 
+bool GeometryCore::getDrawCommand(RenderState* renderState, DrawElementsIndirectCommand& command) {
+  if (drawMode_ != DrawMode::ELEMENTS || !drawRanges_.empty() || streamBuffer_) {
+    return false;
+  }
+  GLint first = 0;
+  GLsizei count = nElements_;
+  if (!lodLevels_.empty()) {
+    lodLevel_ = selectLODLevel_(renderState);
+    first = lodLevels_[lodLevel_].first;
+    count = lodLevels_[lodLevel_].count;
+  }
+  command.count = static_cast<GLuint>(count);
+  command.instanceCount = 1;
+  command.firstIndex = firstIndex_ + static_cast<GLuint>(first);
+  command.baseVertex = baseVertex_;
+  command.baseInstance = 0;
+  return true;
+}
+
+
+bool GeometryCore::isStoredInArena() const {
+  return arena_ != nullptr;
+}
+
+
+GLuint GeometryCore::getVAO() const {
+  return arena_ ? arenaVAO_ : vao_;
+}
+
+
+GLenum GeometryCore::getPrimitiveType() const {
+  return primitiveType_;
+}
+
+
+bool GeometryCore::hasVertexTransform() const {
+  return hasVertexTransform_;
+}
+
+
+const glm::mat4& GeometryCore::getVertexTransform() const {
+  return vertexTransform_;
+}
+
+
+GLenum GeometryCore::getMinIndexType(GLuint maxIndex) {
+  if (maxIndex <= 0xFF) {
+    return GL_UNSIGNED_BYTE;
+  }
+  if (maxIndex <= 0xFFFF) {
+    return GL_UNSIGNED_SHORT;
+  }
+  return GL_UNSIGNED_INT;
+}
+
+
+GLsizei GeometryCore::getIndexSize(GLenum indexType) {
+  GLsizei result;
+  switch (indexType) {
+  case GL_UNSIGNED_BYTE:
+    result = 1;
+    break;
+  case GL_UNSIGNED_SHORT:
+    result = 2;
+    break;
+  default:
+    result = 4;
+    break;
+  }
+  return result;
+}
+
+
+void GeometryCore::packIndices(const GLuint* indices, GLsizei nIndices, GLenum indexType,
+    GLvoid* result) {
+  assert(nIndices == 0 || getIndexSize(getMinIndexType(*std::max_element(indices,
+      indices + nIndices))) <= getIndexSize(indexType));
+  switch (indexType) {
+  case GL_UNSIGNED_BYTE:
+    for (GLsizei i = 0; i < nIndices; ++i) {
+      static_cast<GLubyte*>(result)[i] = static_cast<GLubyte>(indices[i]);
+    }
+    break;
+  case GL_UNSIGNED_SHORT:
+    for (GLsizei i = 0; i < nIndices; ++i) {
+      static_cast<GLushort*>(result)[i] = static_cast<GLushort>(indices[i]);
+    }
+    break;
+  default:
+    std::copy(indices, indices + nIndices, static_cast<GLuint*>(result));
+    break;
+  }
+}
+
+
+void GeometryCore::unpackIndices(const GLvoid* indices, GLsizei nIndices, GLenum indexType,
+    GLuint* result) {
+  switch (indexType) {
+  case GL_UNSIGNED_BYTE:
+    std::copy(static_cast<const GLubyte*>(indices), static_cast<const GLubyte*>(indices) + nIndices,
+        result);
+    break;
+  case GL_UNSIGNED_SHORT:
+    std::copy(static_cast<const GLushort*>(indices), static_cast<const GLushort*>(indices) + nIndices,
+        result);
+    break;
+  default:
+    std::copy(static_cast<const GLuint*>(indices), static_cast<const GLuint*>(indices) + nIndices,
+        result);
+    break;
+  }
+}
+
+
+int GeometryCore::selectLODLevel_(RenderState* renderState) const {
+  const GLint viewportHeight = renderState->getViewport()[3];
+  glm::vec3 modelCenter;
+  GLfloat modelRadius;
+  if (viewportHeight <= 0 || !getBoundingSphere(modelCenter, modelRadius)) {
+    return 0;
+  }
+
+  // bounding sphere in eye coordinates, scaled by the largest scale factor of the model-view matrix
+  const glm::mat4& modelView = renderState->modelViewStack.getMatrix();
+  const glm::vec3 center(modelView * glm::vec4(modelCenter, 1.f));
+  const GLfloat scale = std::sqrt(std::max(glm::dot(modelView[0], modelView[0]),
+      std::max(glm::dot(modelView[1], modelView[1]), glm::dot(modelView[2], modelView[2]))));
+  const GLfloat radius = scale * modelRadius;
+
+  // pixels per unit length at the nearest point of the bounding sphere
+  const glm::mat4& projection = renderState->projectionStack.getMatrix();
+  GLfloat pixelsPerUnit = 0.5f * static_cast<GLfloat>(viewportHeight) * projection[1][1];
+  if (projection[2][3] != 0.f) {
+    // perspective projection
+    const GLfloat distance = -center.z - radius;
+    if (distance <= 0.f) {
+      // camera within bounding sphere or object behind camera
+      return (-center.z + radius < 0.f) ? static_cast<int>(lodLevels_.size()) - 1 : 0;
+    }
+    pixelsPerUnit /= distance;
+  }
+
+  int result = 0;
+  while (result + 1 < static_cast<int>(lodLevels_.size())
+      && lodLevels_[result + 1].error * scale * pixelsPerUnit <= lodThreshold_) {
+    ++result;
+  }
+  return result;
+}
+
+
 } /* namespace scg */
@@ -28,8 +28,13 @@
 #include <functional>
 #include <vector>
 #include "scg_glew.h"
+#include "scg_glm.h"
+#include "BoundingBox.h"
 #include "Core.h"
+#include "GeometryArena.h"
 #include "scg_internals.h"
+#include "StreamBuffer.h"
+#include "VertexLayout.h"
 
 namespace scg {
 
@@ -49,6 +54,21 @@ enum class DrawMode {
  * Vertices and indices are stored in vertex buffer objects (VBOs).
  * Each geometry core has its own vertex array object (VAO) that is used to
  * store attribute and element index bindings.
+ *
+ * Attributes are either stored in separate VBOs (addAttributeData()) or interleaved
+ * in one VBO according to a vertex layout (addVertexData()), which is preferred for
+ * static geometry since all attributes of a vertex are fetched from one memory stream.
+ * Alternatively, vertices and indices may be stored in a GeometryArena shared with other
+ * geometry cores (setArenaData()), which allows to draw them by indirect draw commands.
+ * Vertices that change every frame are stored in a StreamBuffer (setStreamVertexData())
+ * and rewritten by mapVertexData() or updateVertexData() without reallocation.
+ *
+ * Attributes may be stored in packed formats (e.g., normalized 16-bit integers),
+ * with an optional vertex transform that maps the stored positions to model coordinates.
+ *
+ * Optional levels of detail (LOD) are stored as element ranges of the same buffers.
+ * The level to be drawn is selected by projecting its geometric error to the screen,
+ * using the bounding box to determine the distance to the camera.
  */
 class GeometryCore: public Core {
 
@@ -84,18 +104,235 @@ public:
    */
   GeometryCore* addAttributeData(GLuint location, const GLfloat* data, GLsizeiptr size, GLint dim, GLenum usage);
 
+  /**
+   * Add vertex attribute data of the given type that is stored in its own vertex buffer object (VBO).
+   * \param location attribute location the VBO is bound to
+   * \param data attribute data
+   * \param size buffer size in bytes
+   * \param dim dimension of each attribute value, 4 for packed types
+   * \param type GL_FLOAT, GL_HALF_FLOAT, GL_SHORT, GL_UNSIGNED_SHORT, GL_BYTE, GL_UNSIGNED_BYTE,
+   *   GL_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_2_10_10_10_REV (OpenGL 3.3)
+   * \param isNormalized GL_TRUE to map integer values to [-1, 1] (signed) or [0, 1] (unsigned)
+   * \param usage GL_STATIC_DRAW, GL_DYNAMIC_DRAW, or GL_STREAM_DRAW
+   * \return this pointer for method chaining
+   */
+  GeometryCore* addAttributeData(GLuint location, const GLvoid* data, GLsizeiptr size, GLint dim,
+      GLenum type, GLboolean isNormalized, GLenum usage);
+
+  /**
+   * Add vertex data with interleaved attributes that is stored in one vertex buffer object (VBO).
+   * \param layout attribute types and offsets within each vertex
+   * \param data vertex data, layout.getStride() bytes per vertex
+   * \param size buffer size in bytes
+   * \param usage GL_STATIC_DRAW, GL_DYNAMIC_DRAW, or GL_STREAM_DRAW
+   * \return this pointer for method chaining
+   */
+  GeometryCore* addVertexData(const VertexLayout& layout, const GLvoid* data, GLsizeiptr size,
+      GLenum usage);
+
   /**
    * Set element index data that is stored in its own vertex buffer object (VBO).
    *
+   * Indices are stored in the smallest type that can represent the largest index
+   * (GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT, or GL_UNSIGNED_INT), independent of the
+   * type of the given data.
+   *
    * \param data element data
-   * \param size buffer size in bytes
+   * \param size size of data in bytes
    * \param usage GL_STATIC_DRAW, GL_DYNAMIC_DRAW, or GL_STREAM_DRAW
    * \return this pointer for method chaining
    */
   GeometryCore* setElementIndexData(const GLuint* data, GLsizeiptr size, GLenum usage);
 
+  /**
+   * Set element index data given as 16-bit indices, cf. setElementIndexData(const GLuint*, ...).
+   */
+  GeometryCore* setElementIndexData(const GLushort* data, GLsizeiptr size, GLenum usage);
+
+  /**
+   * Set element index data given as 8-bit indices, cf. setElementIndexData(const GLuint*, ...).
+   */
+  GeometryCore* setElementIndexData(const GLubyte* data, GLsizeiptr size, GLenum usage);
+
+  /**
+   * Set element index data that has already been converted to the given index type
+   * (cf. packIndices()), which is stored without further conversion.
+   *
+   * \param data nIndices * getIndexSize(indexType) bytes
+   * \param indexType GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT, or GL_UNSIGNED_INT
+   * \param nIndices number of indices
+   * \param usage GL_STATIC_DRAW, GL_DYNAMIC_DRAW, or GL_STREAM_DRAW
+   * \return this pointer for method chaining
+   */
+  GeometryCore* setElementIndexData(const GLvoid* data, GLenum indexType, GLsizei nIndices,
+      GLenum usage);
+
+  /**
+   * Get type of stored element indices (GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT, or GL_UNSIGNED_INT).
+   */
+  GLenum getIndexType() const;
+
+  /**
+   * Get size of element index data in bytes.
+   */
+  GLsizeiptr getIndexDataSize() const;
+
+  /**
+   * Allocate a stream buffer for vertex data that is rewritten frequently, e.g., every frame.
+   * Vertices have to be written by mapVertexData() or updateVertexData() before rendering.
+   * Element indices (if any) remain static.
+   *
+   * \param layout attribute types and offsets within each vertex
+   * \param nVertices number of vertices written by each update
+   * \param nRegions number of copies of the vertex data, such that the GPU may still read
+   *   previous ones while the next one is written (default: triple buffering)
+   * \return this pointer for method chaining
+   */
+  GeometryCore* setStreamVertexData(const VertexLayout& layout, GLsizei nVertices,
+      int nRegions = StreamBuffer::DEFAULT_N_REGIONS);
+
+  /**
+   * Get pointer for writing the vertex data to be drawn next, as set by setStreamVertexData().
+   * The previous contents are undefined, hence all vertices have to be written.
+   * unmapVertexData() has to be called before rendering.
+   *
+   * \return interleaved vertex data, layout.getStride() bytes per vertex
+   */
+  GLvoid* mapVertexData();
+
+  /**
+   * Finish writing vertex data after mapVertexData().
+   */
+  void unmapVertexData();
+
+  /**
+   * Copy vertex data to be drawn next, as set by setStreamVertexData().
+   *
+   * \param data interleaved vertex data, layout.getStride() bytes per vertex
+   * \param size size of data in bytes, at most nVertices * layout.getStride()
+   * \return this pointer for method chaining
+   */
+  GeometryCore* updateVertexData(const GLvoid* data, GLsizeiptr size);
+
+  /**
+   * Store vertex data with interleaved attributes and element index data in a geometry arena,
+   * instead of vertex buffer objects of this core (DrawMode::ELEMENTS only).
+   *
+   * \param arena geometry arena, shared with other geometry cores
+   * \param layout attribute types and offsets within each vertex
+   * \param vertexData vertex data, layout.getStride() bytes per vertex
+   * \param nVertices number of vertices
+   * \param indices element indices
+   * \param nIndices number of indices
+   * \return this pointer for method chaining
+   */
+  GeometryCore* setArenaData(GeometryArenaSP arena, const VertexLayout& layout,
+      const GLvoid* vertexData, GLsizei nVertices, const GLuint* indices, GLsizei nIndices);
+
+  /**
+   * Store vertex data and element index data of the given index type in a geometry arena,
+   * cf. setArenaData(GeometryArenaSP, const VertexLayout&, const GLvoid*, GLsizei, const GLuint*,
+   * GLsizei). Indices of the arena's index type are copied without conversion.
+   *
+   * \param indexType GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT, or GL_UNSIGNED_INT
+   * \return this pointer for method chaining
+   */
+  GeometryCore* setArenaData(GeometryArenaSP arena, const VertexLayout& layout,
+      const GLvoid* vertexData, GLsizei nVertices, const GLvoid* indices, GLenum indexType,
+      GLsizei nIndices);
+
+  /**
+   * Set transformation from stored vertex positions to model coordinates, e.g., to
+   * dequantize positions stored as normalized integers. The transformation is applied
+   * to the model-view matrix while rendering and should be composed of a translation
+   * and a uniform scaling, such that the normal matrix is only scaled.
+   *
+   * \return this pointer for method chaining
+   */
+  GeometryCore* setVertexTransform(const glm::mat4& matrix);
+
+  /**
+   * Get total size of vertex attribute data in bytes.
+   */
+  GLsizeiptr getAttributeDataSize() const;
+
+  /**
+   * Add a range of elements (vertices for DrawMode::ARRAYS, indices for DrawMode::ELEMENTS)
+   * to be drawn by a separate draw call, after applying the given cores to it,
+   * e.g., one range per material of a model.
+   * If ranges are defined, only elements within ranges are drawn; otherwise,
+   * all elements are drawn by one draw call.
+   *
+   * \param first first element of the range
+   * \param count number of elements
+   * \param cores cores to be applied to the range only (e.g., MaterialCore, Texture2DCore),
+   *   processed in the given order
+   * \return this pointer for method chaining
+   */
+  GeometryCore* addDrawRange(GLint first, GLsizei count, const std::vector<CoreSP>& cores);
+
+  /**
+   * Add a level of detail, i.e., a range of elements that replaces all elements when selected.
+   * Levels have to be added in the order of increasing error, starting with the original
+   * geometry (error 0). If draw ranges are defined, the level is partitioned into
+   * contiguous ranges in the same order, with the given number of elements each.
+   *
+   * \param first first element of the level
+   * \param count number of elements
+   * \param error geometric error in model coordinates
+   * \param rangeCounts number of elements per draw range (empty if there are no draw ranges)
+   * \return this pointer for method chaining
+   */
+  GeometryCore* addLODLevel(GLint first, GLsizei count, GLfloat error,
+      const std::vector<GLsizei>& rangeCounts = std::vector<GLsizei>());
+
+  /**
+   * Set maximum projected error of the selected level of detail (default: 1 pixel).
+   *
+   * \param pixels maximum error in pixels
+   * \return this pointer for method chaining
+   */
+  GeometryCore* setLODThreshold(GLfloat pixels);
+
+  /**
+   * Get number of levels of detail (0 if not defined).
+   */
+  int getNLODLevels() const;
+
+  /**
+   * Get level of detail selected by the last call of render().
+   */
+  int getLODLevel() const;
+
+  /**
+   * Set axis-aligned bounding box in the coordinates of the stored vertices, i.e., before
+   * the vertex transform. Computed automatically when vertex positions are uploaded, only needed
+   * for stream buffers, to override the computed box, or to skip its computation for bounds
+   * that are known in advance: vertex positions uploaded afterwards do not change the box.
+   *
+   * \param boundsRadius radius of the bounding sphere centered at the box center
+   *   (default: -1, i.e., half the box diagonal)
+   * \return this pointer for method chaining
+   */
+  GeometryCore* setBoundingBox(const glm::vec3& boundsMin, const glm::vec3& boundsMax,
+      GLfloat boundsRadius = -1.f);
+
+  /**
+   * Get axis-aligned bounding box in model coordinates, i.e., including the vertex transform.
+   * The box is infinite if no vertex positions have been uploaded.
+   */
+  BoundingBox getBoundingBox() const;
+
+  /**
+   * Get bounding sphere in model coordinates, i.e., including the vertex transform.
+   *
+   * \return false if no vertex positions have been uploaded
+   */
+  bool getBoundingSphere(glm::vec3& center, GLfloat& radius) const;
+
   /**
    * Get approximate number of triangles, called by Shape::getNTriangles().
+   * If levels of detail are defined, the number of triangles of the selected level is returned.
    */
   int getNTriangles() const;
 
@@ -104,15 +341,161 @@ public:
    */
   virtual void render(RenderState* renderState);
 
+  /**
+   * Render several instances of the geometry by one instanced draw call, called by
+   * InstancedShape::render(). The shader distinguishes instances by gl_InstanceID.
+   *
+   * Note: The vertex transform (cf. setVertexTransform()) is not applied, since it
+   * has to follow the instance transforms. The level of detail is selected for the
+   * current model-view matrix.
+   *
+   * \param nInstances number of instances
+   */
+  void renderInstances(RenderState* renderState, GLsizei nInstances);
+
+  /**
+   * Get indexed draw command for the level of detail selected for the current render state,
+   * to be called by DrawBatcher instead of render().
+   *
+   * \param command draw command with instanceCount 1 and baseInstance 0
+   * \return false if the core cannot be drawn by one draw command, i.e., if it is drawn
+   *   without element indices, has draw ranges, or uses a stream buffer
+   */
+  bool getDrawCommand(RenderState* renderState, DrawElementsIndirectCommand& command);
+
+  /**
+   * Check if vertex and index data are stored in a geometry arena (cf. setArenaData()).
+   */
+  bool isStoredInArena() const;
+
+  /**
+   * Get vertex array object, shared with other geometry cores if stored in a geometry arena.
+   */
+  GLuint getVAO() const;
+
+  /**
+   * Get primitive type.
+   */
+  GLenum getPrimitiveType() const;
+
+  /**
+   * Check if a vertex transform has been set (cf. setVertexTransform()).
+   */
+  bool hasVertexTransform() const;
+
+  /**
+   * Get transformation from stored vertex positions to model coordinates.
+   */
+  const glm::mat4& getVertexTransform() const;
+
+  /**
+   * Get smallest index type that can represent indices up to maxIndex.
+   */
+  static GLenum getMinIndexType(GLuint maxIndex);
+
+  /**
+   * Get size of one index of the given type in bytes.
+   */
+  static GLsizei getIndexSize(GLenum indexType);
+
+  /**
+   * Convert indices to the given type, which has to represent all of them.
+   *
+   * \param indices indices to be converted
+   * \param nIndices number of indices
+   * \param indexType GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT, or GL_UNSIGNED_INT
+   * \param result converted indices, nIndices * getIndexSize(indexType) bytes
+   */
+  static void packIndices(const GLuint* indices, GLsizei nIndices, GLenum indexType,
+      GLvoid* result);
+
+  /**
+   * Convert indices of the given type to 32-bit indices, i.e., revert packIndices().
+   *
+   * \param indices nIndices * getIndexSize(indexType) bytes
+   * \param nIndices number of indices
+   * \param indexType GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT, or GL_UNSIGNED_INT
+   * \param result converted indices
+   */
+  static void unpackIndices(const GLvoid* indices, GLsizei nIndices, GLenum indexType,
+      GLuint* result);
+
+  /**
+   * Compute bounding box and radius of the bounding sphere centered at the box center
+   * of vertex positions, as done when vertex positions are uploaded (cf. setBoundingBox()).
+   *
+   * \param data first position
+   * \param stride distance between consecutive positions in bytes
+   * \return false if there are no positions or their type is not supported
+   */
+  static bool computeBounds(const GLvoid* data, GLsizei stride, GLsizei nVertices, GLint dim,
+      GLenum type, GLboolean isNormalized, glm::vec3& boundsMin, glm::vec3& boundsMax,
+      GLfloat& boundsRadius);
+
 protected:
 
+  /**
+   * A range of elements with its own cores.
+   */
+  struct DrawRange {
+    GLint first;
+    GLsizei count;
+    std::vector<CoreSP> cores;
+  };
+
+  /**
+   * A level of detail.
+   */
+  struct LODLevel {
+    GLint first;
+    GLsizei count;
+    GLfloat error;
+    std::vector<GLsizei> rangeCounts;
+  };
+
+  /**
+   * Select the coarsest level of detail whose projected error does not exceed the threshold.
+   */
+  int selectLODLevel_(RenderState* renderState) const;
+
+  /**
+   * Extend bounding box and bounding sphere by vertex positions, called when vertex data
+   * is uploaded. Positions of unsupported types are ignored, leaving the bounds unknown.
+   * Does nothing if the bounding box has been set by setBoundingBox().
+   */
+  void updateBounds_(const GLvoid* data, GLsizei stride, GLsizei nVertices, GLint dim,
+      GLenum type, GLboolean isNormalized);
+
+  /**
+   * Draw geometry, called by render() and renderInstances().
+   */
+  void draw_(RenderState* renderState, GLsizei nInstances, bool isVertexTransformApplied);
+
   GLenum primitiveType_;
   DrawMode drawMode_;
-  std::function<void(GLenum, GLsizei)> drawFunc_;
+  std::function<void(GLenum, GLint, GLsizei, GLsizei)> drawFunc_;
   GLuint vao_;
   std::vector<GLuint> vboAttributes_;
   GLuint vboIndex_;
+  GeometryArenaSP arena_;
+  GLuint arenaVAO_;
+  StreamBufferSP streamBuffer_;
+  GLsizei nStreamVertices_;
+  GLint baseVertex_;
+  GLuint firstIndex_;
+  GLenum indexType_;
   GLsizei nElements_;
+  GLsizeiptr attributeDataSize_;
+  bool hasVertexTransform_;
+  glm::mat4 vertexTransform_;
+  std::vector<DrawRange> drawRanges_;
+  std::vector<LODLevel> lodLevels_;
+  GLfloat lodThreshold_;
+  int lodLevel_;
+  glm::vec3 boundsMin_;
+  glm::vec3 boundsMax_;
+  GLfloat boundsRadius_;
+  bool isBoundingBoxSet_;
 
 };
 
@@ -25,15 +25,35 @@
 #ifndef GEOMETRYCOREFACTORY_H_
 #define GEOMETRYCOREFACTORY_H_
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <string>
 #include <vector>
 #include "scg_glew.h"
+#include "GeometryCore.h"
+#include "MeshProcessor.h"
 #include "scg_glm.h"
 #include "scg_internals.h"
 
 namespace scg {
 
 
+class MappedFile;
+
+
+/**
+ * \brief Vertex attribute formats of geometry cores created by GeometryCoreFactory.
+ */
+enum class VertexFormat {
+  FLOAT,                  ///< 32-bit floats for all attributes (56 bytes per vertex with tangent frame)
+  PACKED,                 ///< normalized 16-bit positions, 10-10-10-2 normals, tangents, and binormals,
+                          ///< half-float texture coordinates (24 bytes per vertex with tangent frame)
+  PACKED_NO_BINORMALS     ///< as PACKED, binormals are reconstructed by the shader from normal,
+                          ///< tangent, and handedness sign (tangent w) (20 bytes per vertex)
+};
+
+
 /**
  * \brief A factory to create geometry cores.
  */
@@ -70,13 +90,130 @@ public:
   /**
    * Load model from OBJ Wavefront file.
    *
-   * Only the follwoing OBJ tags are used: v, vt, vn, f.
-   * If normals are not definied explicitly, they are created separately for each triangle
-   * (as in the case of flat shading); no smoothing of normals is applied.
+   * Only the follwoing OBJ tags are used: v, vt, vn, f, mtllib, usemtl.
+   * If the file does not define any normals, smooth normals are created with respect
+   * to the crease angle (cf. setCreaseAngle()); otherwise, vertices without normal
+   * get the normal of their triangle (as in the case of flat shading).
+   * Tangents and binormals are created for all models, cf. MeshProcessor::computeTangents().
+   *
+   * Faces are grouped by material into contiguous ranges, which are drawn with one
+   * draw call each (cf. GeometryCore::addDrawRange()). Materials are read from the
+   * MTL files referenced by mtllib: a MaterialCore is created from Ka, Kd, Ks, Ke, Ns,
+   * and d (or Tr), and a Texture2DCore from map_Kd. The material "None" written by
+   * Blender for objects without material is ignored, such that the material
+   * of the shape is used.
+   *
+   * With DrawMode::ELEMENTS, each unique combination of vertex, texture coordinate,
+   * and normal is stored only once and referenced by an element index buffer.
+   * With DrawMode::ARRAYS, three separate vertices are stored for each triangle.
+   *
+   * With DrawMode::ELEMENTS, levels of detail are created if enabled by setLODRatios(),
+   * triangles and vertices are reordered for the vertex cache, overdraw, and vertex fetch
+   * (cf. MeshProcessor::optimizeMesh()), and the final buffers are written to a binary mesh cache file next to the OBJ file
+   * (cf. setMeshCacheEnabled()).
+   *
+   * \param fileName file name to be searched for in known file paths
+   * \param drawMode DrawMode::ELEMENTS (default) or DrawMode::ARRAYS
+   */
+  GeometryCoreSP createModelFromOBJFile(const std::string& fileName,
+      DrawMode drawMode = DrawMode::ELEMENTS);
+
+  /**
+   * Enable or disable the binary mesh cache (default: enabled).
+   *
+   * If enabled, createModelFromOBJFile() with DrawMode::ELEMENTS writes its vertex
+   * and index buffers to a file <fileName>.scgmesh next to the OBJ file, if possible.
+   * Later calls map this file and upload its contents without parsing the OBJ file,
+   * as long as the OBJ file has not changed (same size and modification time or same hash).
+   */
+  void setMeshCacheEnabled(bool isEnabled);
+
+  /**
+   * Set crease angle for OBJ models without normals (default: 30 degrees).
+   *
+   * Normals of such models are created by averaging the normals of adjacent triangles
+   * whose normals differ by at most the crease angle, cf. MeshProcessor::computeSmoothNormals().
+   *
+   * \param angleDeg crease angle (degrees), 0 for flat shading, 180 for completely smooth shading
+   */
+  void setCreaseAngle(GLfloat angleDeg);
+
+  /**
+   * Set the levels of detail to be created for OBJ models with DrawMode::ELEMENTS
+   * (default: none).
+   *
+   * The levels are created by MeshProcessor::buildLODChain() and stored in the
+   * buffers of the geometry core, which selects the level to be drawn
+   * by its projected error (cf. GeometryCore::addLODLevel()).
+   *
+   * \param ratios target ratios of the number of triangles of the original model,
+   *   e.g., {0.5, 0.25, 0.1}, in addition to the original model; empty for no levels of detail
+   */
+  void setLODRatios(const std::vector<GLfloat>& ratios);
+
+  /**
+   * Enable or disable adaptive tessellation of spheres, cones, cylinders, conical frustums,
+   * and teapots (default: disabled).
+   *
+   * If enabled, successively coarser tessellations (halving the number of slices,
+   * stacks, or patch segments down to the minimum) are stored as levels of detail
+   * in the buffers of the geometry core, together with their geometric error, such that
+   * the tessellation is selected by its projected error in screen space
+   * (cf. GeometryCore::addLODLevel() and GeometryCore::setLODThreshold()).
+   * The given tessellation is the finest level, i.e., the one drawn close to the camera.
+   */
+  void setAdaptiveTessellationEnabled(bool isEnabled);
+
+  /**
+   * Set vertex attribute format of OBJ models, spheres, cones, cylinders, conical frustums,
+   * gears, and teapots (default: VertexFormat::FLOAT).
+   *
+   * Packed positions are stored relative to the bounding cube of the model, with the
+   * dequantization matrix set as vertex transform of the geometry core
+   * (cf. GeometryCore::setVertexTransform()), i.e., with a precision of 1/65535 of the
+   * model extent. Without OpenGL 3.3 or ARB_vertex_type_2_10_10_10_rev, normals, tangents,
+   * and binormals are stored as normalized 16-bit integers instead.
+   * Half-float texture coordinates lose precision for large values (e.g., repeated textures).
+   */
+  void setVertexFormat(VertexFormat format);
+
+  /**
+   * Enable or disable console output of mesh statistics (default: disabled).
+   *
+   * If enabled, the average cache miss ratio (ACMR) and the average transform to vertex
+   * ratio (ATVR) of indexed models (OBJ models with DrawMode::ELEMENTS, spheres,
+   * conical frustums, and teapots) are printed before and after optimization,
+   * cf. MeshProcessor::analyzeVertexCache(), as well as the size of the vertex attribute data
+   * compared to VertexFormat::FLOAT (cf. setVertexFormat()), which is proportional to
+   * the memory bandwidth of vertex fetches.
+   */
+  void setMeshStatisticsEnabled(bool isEnabled);
+
+  /**
+   * Set geometry arena to store vertices and indices of indexed meshes (OBJ models with
+   * DrawMode::ELEMENTS and generated shapes except XYZ axes and RGB cube) in shared buffers
+   * instead of buffers of their own, such that they can be batched by DrawBatcher
+   * (default: nullptr, i.e., no arena).
+   */
+  void setGeometryArena(GeometryArenaSP arena);
+
+  /**
+   * Load model from OBJ Wavefront file asynchronously, cf. createModelFromOBJFile().
+   *
+   * The file is loaded and parsed by a worker thread, several files are loaded in parallel.
+   * The returned handle provides an empty geometry core that can be added to the scene
+   * graph immediately and that is filled by GeometryCoreFuture::update(), which is
+   * called by the Viewer main loop once per frame.
+   * Exceptions (e.g., file not found) are passed on by GeometryCoreFuture::update()
+   * and GeometryCoreFuture::wait().
+   *
+   * This method and the handle must be used in the thread of the OpenGL context.
    *
    * \param fileName file name to be searched for in known file paths
+   * \param drawMode DrawMode::ELEMENTS (default) or DrawMode::ARRAYS
    */
-  GeometryCoreSP createModelFromOBJFile(const std::string& fileName);
+  GeometryCoreFutureSP createModelFromOBJFileAsync(const std::string& fileName,
+      DrawMode drawMode = DrawMode::ELEMENTS);
 
 
   /*
@@ -88,10 +225,6 @@ public:
   GeometryCoreSP createBroccoli();
   GeometryCoreSP createLamp();
   GeometryCoreSP createBulb();
-  /*
-   * Create a Gear
-   */
-  GeometryCoreSP createGearOld(double l, double k, double z, double w1, double w2);
 
   /**
    * Create rectangle in xy plane with normals, tangents, binormals, and
@@ -172,16 +305,38 @@ public:
   GeometryCoreSP createConicalFrustum(GLfloat baseRadius, GLfloat topRadius,
       GLfloat height, int nSlices, int nStacks, bool hasCaps = true);
 
+  /**
+   * Create involute spur gear in xy plane, extruded along z axis and centered at origin,
+   * with normals.
+   *
+   * The tooth profile follows the standard basic rack, i.e., the addendum is module
+   * and the dedendum is 1.25 * module. It is computed once and replicated for all teeth.
+   *
+   * \param nTeeth number of teeth (at least 3)
+   * \param module module, i.e., pitch diameter divided by number of teeth
+   * \param pressureAngleDeg pressure angle (degrees, default: 20)
+   * \param thickness face width in z direction
+   * \param boreRadius radius of central hole (0 for none, must be less than root radius)
+   * \param nFlankSegments number of line segments per tooth flank (default: 4)
+   */
+  GeometryCoreSP createGear(int nTeeth, GLfloat module, GLfloat pressureAngleDeg = 20.f,
+      GLfloat thickness = 1.f, GLfloat boreRadius = 0.f, int nFlankSegments = 4);
+
   /**
    * Create Utah teapot along z axis and centered at origin with normals, tangents,
    * binormals, and texture coordinates
-   * (1024 triangles).
+   * (64 * nPatchSegments^2 triangles, i.e., 1024 triangles by default).
    *
-   * Data source: https://cvs.khronos.org/svn/repos/registry/trunk/public/webgl/sdk/demos/google/shiny-teapot/index.html
+   * The 32 bicubic Bezier patches of the original model by Martin Newell are evaluated
+   * on a regular grid, with normals, tangents, and binormals computed from the
+   * partial derivatives of the patches.
+   *
+   * Texture coordinates as in: https://cvs.khronos.org/svn/repos/registry/trunk/public/webgl/sdk/demos/google/shiny-teapot/index.html
    *
    * \param size approximate diameter
+   * \param nPatchSegments number of segments per patch edge (default: 4)
    */
-  GeometryCoreSP createTeapot(GLfloat size);
+  GeometryCoreSP createTeapot(GLfloat size, int nPatchSegments = 4);
 
   /**
    * Create Utah teapot along z axis and centered at origin with normals and texture coordinates
@@ -218,49 +373,432 @@ protected:
     FaceEntry()
         : vertex(0), texCoord(0), normal(0) {
     }
+    bool operator==(const FaceEntry& other) const {
+      return vertex == other.vertex && texCoord == other.texCoord && normal == other.normal;
+    }
     int vertex;
     int texCoord;
     int normal;
   };
 
   /**
-   * A face definition of an OBJ file.
+   * Hash function for face entries, used to find identical vertices.
    */
-  struct Face{
-    Face()
-        : nTriangles(0) {
+  struct FaceEntryHash {
+    size_t operator()(const FaceEntry& entry) const {
+      size_t result = static_cast<size_t>(entry.vertex);
+      result = result * 31 + static_cast<size_t>(entry.texCoord);
+      result = result * 31 + static_cast<size_t>(entry.normal);
+      return result;
     }
-    int nTriangles;
-    std::vector<FaceEntry> entries;
+  };
+
+  /**
+   * Start of a sequence of faces with the same material (usemtl).
+   */
+  struct MaterialRun {
+    int face;
+    int material;
   };
 
   /**
    * A model stored in an OBJ file.
+   *
+   * The entries of all faces are stored contiguously; face i consists of the entries
+   * faceOffsets[i] to faceOffsets[i + 1] - 1 (i.e., faceOffsets has one more element
+   * than there are faces).
+   * Faces before the first material run have no material.
    */
   struct OBJModel {
     OBJModel()
-        : nVertices(0), nTriangles(0) {
+        : nVertices(0), nTriangles(0), faceOffsets(1, 0) {
+    }
+    int getNFaces() const {
+      return static_cast<int>(faceOffsets.size()) - 1;
     }
     int nVertices;
     int nTriangles;
     std::vector<glm::vec3> vertices;
     std::vector<glm::vec2> texCoords;
     std::vector<glm::vec3> normals;
-    std::vector<Face> faces;
+    std::vector<FaceEntry> entries;
+    std::vector<int> faceOffsets;
+    std::vector<std::string> materialLibraries;
+    std::vector<std::string> materialNames;
+    std::vector<MaterialRun> materialRuns;
+  };
+
+  /**
+   * A material defined in an MTL file.
+   */
+  struct MTLMaterial {
+    MTLMaterial()
+        : ambient(0.f), diffuse(0.8f), specular(0.f), emission(0.f),
+          shininess(0.f), alpha(1.f) {
+    }
+    std::string name;
+    glm::vec3 ambient;
+    glm::vec3 diffuse;
+    glm::vec3 specular;
+    glm::vec3 emission;
+    GLfloat shininess;
+    GLfloat alpha;
+    std::string diffuseMap;   // full file name, empty if not defined or not found
+  };
+
+  /**
+   * Vertex layout, vertex transform, element index type, and bounds of a mesh packed by
+   * packMesh_(), i.e., of the interleaved vertex data and element indices uploaded to the
+   * geometry core. The bounds refer to the packed positions, cf. GeometryCore::setBoundingBox().
+   */
+  struct PackedMesh {
+    VertexLayout layout;
+    GLsizei nVertices;
+    glm::mat4 vertexTransform;    // dequantization of packed positions, identity for FLOAT
+    GLenum indexType;
+    GLsizei nIndices;
+    glm::vec3 boundsMin;          // empty box (min > max) if there are no vertices
+    glm::vec3 boundsMax;
+    GLfloat boundsRadius;
+  };
+
+  /**
+   * Header of a binary mesh cache file, followed by the attribute records of the vertex layout
+   * as (location, dim, type, isNormalized, offset), the interleaved vertex data, and the element
+   * indices (of the given index type) at the given byte offsets, i.e., the data is stored
+   * as uploaded in the vertex format (and packed direction type) the cache has been created with,
+   * together with its bounds.
+   * The draw ranges are stored as (first, count) pairs, the material library names
+   * and the material names of the draw ranges as sequence of zero-terminated strings.
+   * The LOD block contains the LOD ratios the cache has been created with, followed by
+   * the levels of detail as (first, count, error, range counts) records.
+   */
+  struct MeshCacheHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t vertexFormat;
+    uint32_t hasPackedDirections;
+    uint32_t nVertices;
+    uint32_t nIndices;
+    uint32_t indexType;
+    uint32_t nAttributes;
+    uint32_t stride;
+    uint64_t sourceSize;
+    int64_t sourceModificationTime;
+    uint64_t sourceHash;
+    float creaseAngle;
+    uint32_t nDrawRanges;
+    uint32_t nMaterialLibraries;
+    uint32_t nLODRatios;
+    uint32_t nLODLevels;
+    float vertexTransform[16];
+    float boundsMin[3];
+    float boundsMax[3];
+    float boundsRadius;
+    uint64_t attributeOffset;
+    uint64_t vertexOffset;
+    uint64_t indexOffset;
+    uint64_t drawRangeOffset;
+    uint64_t stringOffset;
+    uint64_t stringSize;
+    uint64_t lodOffset;
+  };
+
+  /**
+   * Partial model parsed from a line-aligned chunk of an OBJ file.
+   * Relative (negative) face indices are stored relative to the chunk and
+   * listed in relativeEntries, to be resolved when merging the chunks.
+   */
+  struct OBJChunk {
+    /**
+     * Index of a face entry with relative indices and the numbers of elements
+     * defined before within the chunk.
+     */
+    struct RelativeEntry {
+      size_t entry;
+      int nVertices;
+      int nTexCoords;
+      int nNormals;
+    };
+    OBJModel model;
+    std::vector<RelativeEntry> relativeEntries;
   };
 
   /**
    * Load and parse an OBJ Wavefront file and create a model.
    *
-   * Only the follwoing OBJ tags are used: v, vt, vn, f.
-   * If normals are not definied explicitly, they are created separately for each triangle
-   * (as in the case of flat shading); no smoothing of normals is applied.
+   * The file is memory-mapped and split into line-aligned chunks, which are parsed
+   * in parallel and merged afterwards.
+   *
+   * Only the follwoing OBJ tags are used: v, vt, vn, f, mtllib, usemtl.
    */
   int loadOBJFile_(const std::string& fileName, OBJModel& model) const;
 
+  /**
+   * Load and convert model from OBJ Wavefront file or mesh cache file, and pack its vertex
+   * attributes and element indices in the vertex format of the factory.
+   * Performs no OpenGL calls and may thus be called by a worker thread.
+   *
+   * \param hasPackedDirections true if the vertex format is not VertexFormat::FLOAT and
+   *   supported by the OpenGL context, cf. isPackedDirectionFormatSupported_()
+   * \return function that uploads the model to a geometry core with the given draw mode,
+   *   to be called in the thread of the OpenGL context
+   */
+  std::function<void(GeometryCore&)> loadModel_(const std::string& fileName, DrawMode drawMode,
+      bool hasPackedDirections) const;
+
+  /**
+   * Sort faces by material and define the draw ranges and material libraries of the mesh.
+   * No draw ranges are defined if the model does not use any material.
+   *
+   * \param faceOrder face indices in the order they shall be added to the mesh
+   */
+  void groupFacesByMaterial_(const OBJModel& model, std::vector<int>& faceOrder,
+      MeshData& mesh) const;
+
+  /**
+   * Create mesh with three separate vertices per triangle (DrawMode::ARRAYS).
+   * Vertices without explicit normal get the normal of their triangle.
+   */
+  void createArraysMeshFromOBJModel_(const OBJModel& model, const std::vector<int>& faceOrder,
+      MeshData& mesh) const;
+
+  /**
+   * Create indexed mesh with unique vertices and element indices (DrawMode::ELEMENTS).
+   * Vertices without explicit normal are not shared, since they get the normal
+   * of their triangle.
+   */
+  void createIndexedMeshFromOBJModel_(const OBJModel& model, const std::vector<int>& faceOrder,
+      MeshData& mesh) const;
+
+  /**
+   * Load the materials of the draw ranges of a mesh from its material libraries,
+   * which are searched for next to the OBJ file and in the known file paths.
+   * Missing libraries, materials, and textures are ignored.
+   *
+   * \param materials one material per draw range (with empty name if not found)
+   */
+  void loadMaterials_(const std::string& fullFileName, const MeshData& mesh,
+      std::vector<MTLMaterial>& materials) const;
+
+  /**
+   * Parse the materials defined in an MTL file.
+   */
+  static void parseMTLFile_(const char* begin, const char* end, std::vector<MTLMaterial>& materials);
+
+  /**
+   * Add draw ranges with material and texture cores and levels of detail to geometry core.
+   */
+  static void addRanges_(GeometryCore& core, const MeshData& mesh,
+      const std::vector<MTLMaterial>& materials);
+
+  /**
+   * Upload mesh to geometry core.
+   */
+  static void uploadMesh_(const MeshData& mesh, GeometryCore& core, VertexFormat format,
+      const GeometryArenaSP& arena);
+
+  /**
+   * Upload vertex attribute and element index arrays to geometry core, cf. packMesh_().
+   *
+   * \param format vertex attribute format
+   * \param arena geometry arena to store indexed meshes in, may be nullptr
+   * \param tangents tangents, may be nullptr
+   * \param binormals binormals, may be nullptr
+   * \param texCoords texture coordinates, may be nullptr
+   * \param texCoordSize number of components per texture coordinate
+   * \param indices element indices, may be nullptr for DrawMode::ARRAYS
+   */
+  static void uploadMeshArrays_(GeometryCore& core, VertexFormat format,
+      const GeometryArenaSP& arena, const GLfloat* vertices,
+      const GLfloat* normals, const GLfloat* tangents, const GLfloat* binormals,
+      const GLfloat* texCoords, GLint texCoordSize, GLsizei nVertices,
+      const GLuint* indices, GLsizei nIndices);
+
+  /**
+   * Interleave vertex attribute arrays in the given format, convert element indices
+   * to the minimum index type (cf. GeometryCore::getMinIndexType()), and compute the bounds.
+   * Performs no OpenGL calls.
+   *
+   * \param hasPackedDirections true to pack normals, tangents, and binormals as
+   *   GL_INT_2_10_10_10_REV instead of GL_SHORT (ignored for VertexFormat::FLOAT)
+   * \param tangents tangents, may be nullptr
+   * \param binormals binormals, may be nullptr
+   * \param texCoords texture coordinates, may be nullptr
+   * \param texCoordSize number of components per texture coordinate
+   * \param indices element indices, may be nullptr for DrawMode::ARRAYS
+   * \param vertexData interleaved vertex data (output)
+   * \param indexData converted element indices (output)
+   */
+  static void packMesh_(VertexFormat format, bool hasPackedDirections, const GLfloat* vertices,
+      const GLfloat* normals, const GLfloat* tangents, const GLfloat* binormals,
+      const GLfloat* texCoords, GLint texCoordSize, GLsizei nVertices,
+      const GLuint* indices, GLsizei nIndices, PackedMesh& packedMesh,
+      std::vector<GLubyte>& vertexData, std::vector<GLubyte>& indexData);
+
+  /**
+   * Upload packed vertex data and element indices to geometry core, without conversion.
+   * All attributes are interleaved in one vertex buffer object. The bounds are set
+   * explicitly, such that the geometry core need not decode the positions.
+   *
+   * \param arena geometry arena to store indexed meshes in, may be nullptr
+   * \param vertexData packedMesh.nVertices * packedMesh.layout.getStride() bytes
+   * \param indexData element indices of packedMesh.indexType, may be nullptr for DrawMode::ARRAYS
+   */
+  static void uploadPackedMesh_(GeometryCore& core, const GeometryArenaSP& arena,
+      const PackedMesh& packedMesh, const GLvoid* vertexData, const GLvoid* indexData);
+
+  /**
+   * Copy unit vectors (normals, tangents, binormals) into interleaved vertex data,
+   * packed in the attribute type of the layout (GL_INT_2_10_10_10_REV or GL_SHORT).
+   *
+   * \param signs handedness signs (w component), may be nullptr
+   */
+  static void copyPackedDirections_(const VertexLayout& layout, GLuint location,
+      const GLfloat* directions, const GLfloat* signs, GLsizei nVertices, GLubyte* vertexData);
+
+  /**
+   * Check if the current OpenGL context supports GL_INT_2_10_10_10_REV vertex attributes
+   * (OpenGL 3.3 or ARB_vertex_type_2_10_10_10_rev).
+   */
+  static bool isPackedDirectionFormatSupported_();
+
+  /**
+   * Optimize indexed mesh of a procedural primitive in place for the vertex cache, overdraw,
+   * and vertex fetch (cf. MeshProcessor::optimizeMesh()), upload it in the vertex format
+   * of the factory together with its levels of detail, and print mesh statistics if enabled.
+   *
+   * \param name model name for statistics output
+   */
+  void uploadOptimizedMesh_(GeometryCore& core, const std::string& name, MeshData& mesh) const;
+
+  /**
+   * Add level of detail from index first to the end of the mesh indices, preceded by
+   * level 0 (all previous indices) when called for the first time.
+   *
+   * \param error geometric error in model coordinates
+   */
+  static void addTessellationLevel_(MeshData& mesh, GLuint first, GLfloat error);
+
+  /**
+   * Append sphere to mesh, cf. createSphere().
+   */
+  static void appendSphere_(MeshData& mesh, GLfloat radius, int nSlices, int nStacks);
+
+  /**
+   * Append conical frustum to mesh, cf. createConicalFrustum().
+   */
+  static void appendConicalFrustum_(MeshData& mesh, GLfloat baseRadius, GLfloat topRadius,
+      GLfloat height, int nSlices, int nStacks, bool hasCaps);
+
+  /**
+   * Append teapot to mesh, cf. createTeapot().
+   *
+   * \return maximum distance of the patch surface from the centers of the grid cells,
+   *   i.e., the geometric error of the tessellation
+   */
+  static GLfloat appendTeapot_(MeshData& mesh, GLfloat size, int nPatchSegments);
+
+  /**
+   * Print vertex cache statistics before and after optimization to console.
+   */
+  static void printVertexCacheStatistics_(const std::string& name,
+      const VertexCacheStatistics& before, const VertexCacheStatistics& after);
+
+  /**
+   * Print size of uploaded vertex attribute data and size of the attributes
+   * in VertexFormat::FLOAT to console.
+   */
+  static void printVertexDataStatistics_(const std::string& name, const GeometryCore& core,
+      GLsizei nVertices, bool hasTangents, bool hasBinormals, GLint texCoordSize);
+
+  /**
+   * Map the mesh cache file of the given OBJ file and read the layout of its packed mesh.
+   *
+   * \param hasPackedDirections cf. loadModel_()
+   * \return false if the cache file does not exist, is invalid, is outdated, or has been
+   *   created with another vertex format
+   */
+  bool openMeshCache_(const std::string& fullFileName, bool hasPackedDirections,
+      MappedFile& cacheFile, PackedMesh& packedMesh) const;
+
+  /**
+   * Upload packed mesh of mapped mesh cache file to geometry core, directly from the mapping.
+   */
+  static void uploadMeshCache_(const MappedFile& cacheFile, const PackedMesh& packedMesh,
+      GeometryCore& core, const GeometryArenaSP& arena);
+
+  /**
+   * Read draw ranges, levels of detail, and material libraries from mapped mesh cache file.
+   */
+  static void readMeshCacheRanges_(const MappedFile& cacheFile, MeshData& mesh);
+
+  /**
+   * Write mesh cache file for the given OBJ file, with draw ranges, levels of detail,
+   * and material libraries of the mesh and the packed vertex data and element indices.
+   * Errors are ignored.
+   *
+   * \param hasPackedDirections cf. loadModel_()
+   */
+  void writeMeshCache_(const std::string& fullFileName, const MeshData& mesh,
+      bool hasPackedDirections, const PackedMesh& packedMesh, const std::vector<GLubyte>& vertexData,
+      const std::vector<GLubyte>& indexData) const;
+
+  /**
+   * Compute hash value of OBJ file contents.
+   */
+  static uint64_t hashMeshCacheSource_(const char* data, size_t size);
+
+  /**
+   * Parse the OBJ lines in [begin, end), which must start at the beginning of a line.
+   * Numbers are parsed independently of the current locale.
+   */
+  static void parseOBJChunk_(const char* begin, const char* end, OBJChunk& chunk);
+
+  /**
+   * Parse a floating point number at position p (skipping leading white space)
+   * and advance p behind it.
+   *
+   * \return true if a number has been found
+   */
+  static bool parseFloat_(const char*& p, const char* end, float& value);
+
+  /**
+   * Parse an integer number at position p (skipping leading white space)
+   * and advance p behind it.
+   *
+   * \return true if a number has been found
+   */
+  static bool parseInt_(const char*& p, const char* end, int& value);
+
+  /**
+   * Check if the line at position p starts with the given keyword followed by white space,
+   * and advance p behind it.
+   */
+  static bool parseKeyword_(const char*& p, const char* end, const char* keyword);
+
+  /**
+   * Get the remainder of the line at position p without leading and trailing white space.
+   */
+  static std::string parseName_(const char* p, const char* end);
+
+public:
+
+  // binary mesh cache file format
+  static const char MESH_CACHE_MAGIC[8];
+  static const uint32_t MESH_CACHE_VERSION = 7;
+  static const char* const MESH_CACHE_EXTENSION;
+
 protected:
 
   std::vector<std::string> filePaths_;
+  bool isMeshCacheEnabled_;
+  GLfloat creaseAngle_;
+  std::vector<GLfloat> lodRatios_;
+  VertexFormat vertexFormat_;
+  bool isMeshStatisticsEnabled_;
+  bool isAdaptiveTessellationEnabled_;
+  GeometryArenaSP geometryArena_;
 
 };
 
@@ -0,0 +1,123 @@
+/**
+ * \file GeometryCoreFuture.cpp
+ *
+ * \author Projektgruppe "Zahnradapparatus"
+ */
+
+/*
+ * Copyright 2026 Projektgruppe "Zahnradapparatus"
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cassert>
+#include <chrono>
+#include <stdexcept>
+#include "GeometryCore.h"
+#include "GeometryCoreFuture.h"
+
+namespace scg {
+
+
+std::vector<GeometryCoreFutureSP> GeometryCoreFuture::pending_;
+
+
+GeometryCoreFuture::GeometryCoreFuture(GeometryCoreSP core,
+    std::future<std::function<void(GeometryCore&)>>&& upload)
+    : core_(core), upload_(std::move(upload)), isReady_(false) {
+  assert(core_);
+  assert(upload_.valid());
+}
+
+
+GeometryCoreFuture::~GeometryCoreFuture() {
+}
+
+
+GeometryCoreFutureSP GeometryCoreFuture::create(GeometryCoreSP core,
+    std::future<std::function<void(GeometryCore&)>>&& upload) {
+  auto future = std::make_shared<GeometryCoreFuture>(core, std::move(upload));
+  pending_.push_back(future);
+  return future;
+}
+
+
+GeometryCoreSP GeometryCoreFuture::getCore() const {
+  return core_;
+}
+
+
+bool GeometryCoreFuture::isReady() const {
+  return isReady_;
+}
+
+
+bool GeometryCoreFuture::isPending() const {
+  return !isReady_ && upload_.valid();
+}
+
+
+bool GeometryCoreFuture::update() {
+  if (isPending() && upload_.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+    wait();
+  }
+  return isReady_;
+}
+
+
+GeometryCoreSP GeometryCoreFuture::wait() {
+  if (!isReady_) {
+    if (!upload_.valid()) {
+      throw std::runtime_error("loading has failed before [GeometryCoreFuture::wait()]");
+    }
+    // get() passes on exceptions of the worker thread
+    auto upload = upload_.get();
+    upload(*core_);
+    isReady_ = true;
+  }
+  return core_;
+}
+
+
+size_t GeometryCoreFuture::updateAll() {
+  std::vector<GeometryCoreFutureSP> pending;
+  pending.swap(pending_);
+  for (size_t i = 0; i < pending.size(); ++i) {
+    try {
+      pending[i]->update();
+      if (pending[i]->isPending()) {
+        pending_.push_back(pending[i]);
+      }
+    }
+    catch (...) {
+      // drop failed handle, keep the remaining ones
+      pending_.insert(pending_.end(), pending.begin() + i + 1, pending.end());
+      throw;
+    }
+  }
+  return pending_.size();
+}
+
+
+void GeometryCoreFuture::waitAll() {
+  while (!pending_.empty()) {
+    auto future = pending_.front();
+    pending_.erase(pending_.begin());
+    if (future->isPending()) {
+      future->wait();
+    }
+  }
+}
+
+
+} /* namespace scg */
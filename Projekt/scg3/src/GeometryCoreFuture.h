@@ -0,0 +1,132 @@
+/**
+ * \file GeometryCoreFuture.h
+ * \brief A handle of a geometry core that is loaded asynchronously.
+ *
+ * \author Projektgruppe "Zahnradapparatus"
+ */
+
+/*
+ * Copyright 2026 Projektgruppe "Zahnradapparatus"
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GEOMETRYCOREFUTURE_H_
+#define GEOMETRYCOREFUTURE_H_
+
+#include <functional>
+#include <future>
+#include <vector>
+#include "scg_internals.h"
+
+namespace scg {
+
+
+/**
+ * \brief A handle of a geometry core that is loaded asynchronously,
+ * cf. GeometryCoreFactory::createModelFromOBJFileAsync().
+ *
+ * The geometry core is available immediately, but remains empty until a worker
+ * thread has finished loading and the data has been uploaded by update() or wait().
+ * Pending handles are kept in a global list, which is processed by updateAll()
+ * in the Viewer main loop.
+ *
+ * All methods must be called in the thread of the OpenGL context.
+ */
+class GeometryCoreFuture {
+
+public:
+
+  /**
+   * Constructor.
+   *
+   * \param core empty geometry core to be filled
+   * \param upload result of the worker thread, a function that uploads the data to the core
+   */
+  GeometryCoreFuture(GeometryCoreSP core, std::future<std::function<void(GeometryCore&)>>&& upload);
+
+  /**
+   * Destructor, waits for the worker thread if it is still running.
+   */
+  virtual ~GeometryCoreFuture();
+
+  /**
+   * Create shared pointer and add it to the list of pending handles.
+   */
+  static GeometryCoreFutureSP create(GeometryCoreSP core,
+      std::future<std::function<void(GeometryCore&)>>&& upload);
+
+  /**
+   * Get geometry core, which is empty until isReady() returns true.
+   */
+  GeometryCoreSP getCore() const;
+
+  /**
+   * Check if the geometry core has been filled.
+   */
+  bool isReady() const;
+
+  /**
+   * Check if the worker thread is still running or its data has not been uploaded yet,
+   * i.e., the geometry core is neither ready nor has loading failed.
+   */
+  bool isPending() const;
+
+  /**
+   * Upload data to the geometry core if the worker thread has finished (non-blocking).
+   *
+   * \return true if the geometry core is ready
+   */
+  bool update();
+
+  /**
+   * Wait for the worker thread and upload data to the geometry core (blocking).
+   *
+   * \return geometry core
+   */
+  GeometryCoreSP wait();
+
+  /**
+   * Update all pending handles and remove finished or failed ones from the list,
+   * called by Viewer::startMainLoop() at the beginning of each frame.
+   *
+   * \return number of handles that are still pending
+   */
+  static size_t updateAll();
+
+  /**
+   * Wait for all pending handles and upload their data.
+   */
+  static void waitAll();
+
+private:
+
+  /**
+   * Disallow copy constructor and assignment operator.
+   */
+  SCG_DISALLOW_COPY_AND_ASSIGN(GeometryCoreFuture);
+
+protected:
+
+  GeometryCoreSP core_;
+  std::future<std::function<void(GeometryCore&)>> upload_;
+  bool isReady_;
+
+  static std::vector<GeometryCoreFutureSP> pending_;
+
+};
+
+
+} /* namespace scg */
+
+#endif /* GEOMETRYCOREFUTURE_H_ */
@@ -52,6 +52,7 @@ Group* Group::addCore(CoreSP core) {
     throw std::runtime_error("Disallowed core type GeometryCore [Group::addCore()]");
   }
   cores_.push_back(core);
+  incrementStructureGeneration_();
   return this;
 }
 
@@ -33,7 +33,8 @@ namespace scg {
 
 
 InfoTraverser::InfoTraverser(RenderState* renderState)
-    : Traverser(renderState), nNodes_(0), nCores_(0), nTriangles_(0) {
+    : Traverser(renderState), nNodes_(0), nCores_(0), nTriangles_(0), nCulledNodes_(0),
+      nWorldMatrixHits_(0), nWorldMatrixMisses_(0) {
 }
 
 
@@ -42,7 +43,10 @@ InfoTraverser::~InfoTraverser() {
 
 
 void InfoTraverser::clear() {
-  nNodes_ = nCores_ = nTriangles_ = 0;
+  nNodes_ = nCores_ = nTriangles_ = nCulledNodes_ = 0;
+  nWorldMatrixHits_ = Transformation::getNWorldMatrixHits();
+  nWorldMatrixMisses_ = Transformation::getNWorldMatrixMisses();
+  Transformation::resetWorldMatrixStatistics();
 }
 
 
@@ -61,6 +65,30 @@ int InfoTraverser::getNTriangles() const {
 }
 
 
+int InfoTraverser::getNCulledNodes() const {
+  return nCulledNodes_;
+}
+
+
+unsigned long InfoTraverser::getNWorldMatrixHits() const {
+  return nWorldMatrixHits_;
+}
+
+
+unsigned long InfoTraverser::getNWorldMatrixMisses() const {
+  return nWorldMatrixMisses_;
+}
+
+
+bool InfoTraverser::isCulled(Node* node) {
+  const bool result = Traverser::isCulled(node);
+  if (result) {
+    nCulledNodes_++;
+  }
+  return result;
+}
+
+
 void InfoTraverser::visitLightPosition(LightPosition* node) {
   nNodes_++;
   nCores_ += node->getNCores();
@@ -77,6 +105,17 @@ void InfoTraverser::visitShape(Shape* node) {
 void InfoTraverser::visitCamera(Camera* node) {
   nNodes_++;
   nCores_ += node->getNCores();
+  if (isCullingEnabled_) {
+    // apply camera transformation, but do not render coordinate axes
+    node->Transformation::render(renderState_);
+  }
+}
+
+
+void InfoTraverser::visitPostCamera(Camera* node) {
+  if (isCullingEnabled_) {
+    node->renderPost(renderState_);
+  }
 }
 
 
@@ -95,6 +134,16 @@ void InfoTraverser::visitLight(Light* node) {
 void InfoTraverser::visitTransformation(Transformation* node) {
   nNodes_++;
   nCores_ += node->getNCores();
+  if (isCullingEnabled_) {
+    node->render(renderState_);
+  }
+}
+
+
+void InfoTraverser::visitPostTransformation(Transformation* node) {
+  if (isCullingEnabled_) {
+    node->renderPost(renderState_);
+  }
 }
 
 
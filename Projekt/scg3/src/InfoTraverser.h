@@ -33,6 +33,14 @@ namespace scg {
 
 /**
  * \brief A traverser that gathers information about the scene graph (visitor pattern).
+ *
+ * If view-frustum culling is enabled (cf. Traverser::setCullingEnabled()), transformations
+ * are applied, and only nodes that are not culled are counted. In this case, the projection
+ * and view transformation have to be set before the traversal (cf. StandardRenderer::getInfo()).
+ *
+ * The numbers of world matrix cache hits and misses (cf. Transformation::getWorldMatrix())
+ * are taken over by clear(), i.e., they refer to the frames rendered since the previous
+ * call of clear().
  */
 class InfoTraverser: public Traverser {
 
@@ -49,7 +57,7 @@ public:
   virtual ~InfoTraverser();
 
   /**
-   * Clear stored information.
+   * Clear stored information, take over and reset numbers of world matrix cache hits and misses.
    */
   void clear();
 
@@ -68,6 +76,27 @@ public:
    */
   int getNTriangles() const;
 
+  /**
+   * Get number of nodes skipped by view-frustum culling, each one counting for its sub-tree.
+   */
+  int getNCulledNodes() const;
+
+  /**
+   * Get number of world matrices taken from the cache between the last two calls of clear().
+   */
+  unsigned long getNWorldMatrixHits() const;
+
+  /**
+   * Get number of world matrices recomputed between the last two calls of clear().
+   */
+  unsigned long getNWorldMatrixMisses() const;
+
+  /**
+   * Check if node and its sub-tree are to be skipped by view-frustum culling,
+   * update nCulledNodes_.
+   */
+  virtual bool isCulled(Node* node);
+
   // leaf nodes
 
   /**
@@ -83,10 +112,15 @@ public:
   // composite nodes
 
   /**
-   * Visit Camera node, update nNodes_ and nCores_.
+   * Visit Camera node, update nNodes_ and nCores_, apply transformation if culling is enabled.
    */
   virtual void visitCamera(Camera* node);
 
+  /**
+   * Visit Camera node after traversing sub-tree, restore transformation if culling is enabled.
+   */
+  virtual void visitPostCamera(Camera* node);
+
   /**
    * Visit Group node, update nNodes_ and nCores_.
    */
@@ -98,15 +132,25 @@ public:
   virtual void visitLight(Light* node);
 
   /**
-   * Visit Transformation node, update nNodes_ and nCores_.
+   * Visit Transformation node, update nNodes_ and nCores_, apply transformation
+   * if culling is enabled.
    */
   virtual void visitTransformation(Transformation* node);
 
+  /**
+   * Visit Transformation node after traversing sub-tree, restore transformation
+   * if culling is enabled.
+   */
+  virtual void visitPostTransformation(Transformation* node);
+
 protected:
 
   int nNodes_;
   int nCores_;
   int nTriangles_;
+  int nCulledNodes_;
+  unsigned long nWorldMatrixHits_;
+  unsigned long nWorldMatrixMisses_;
 
 };
 
@@ -0,0 +1,247 @@
+/**
+ * \file InstancedShape.cpp
+ *
+ * \author Projektgruppe "Zahnradapparatus"
+ */
+
+/*
+ * Copyright 2026 Projektgruppe "Zahnradapparatus"
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include "GeometryCore.h"
+#include "InstancedShape.h"
+#include "Traverser.h"
+#include "scg_utilities.h"
+
+namespace scg {
+
+
+// number of texels per instance: transformation (4), normal matrix (3), color (1)
+static const int INSTANCE_DATA_TEXELS = 8;
+
+
+InstancedShape::InstancedShape()
+    : isInstanceDataModified_(true), vertexTransform_(1.f) {
+  createInstanceTextures_(1);
+}
+
+
+InstancedShape::InstancedShape(GeometryCoreSP geometryCore)
+    : isInstanceDataModified_(true), vertexTransform_(1.f) {
+  createInstanceTextures_(1);
+  addCore(geometryCore);
+}
+
+
+InstancedShape::~InstancedShape() {
+  if (isGLContextActive()) {
+    glDeleteTextures(static_cast<GLsizei>(instanceTextures_.size()), instanceTextures_.data());
+    glDeleteBuffers(static_cast<GLsizei>(instanceBuffers_.size()), instanceBuffers_.data());
+  }
+}
+
+
+InstancedShapeSP InstancedShape::create() {
+  return std::make_shared<InstancedShape>();
+}
+
+
+InstancedShapeSP InstancedShape::create(GeometryCoreSP geometryCore) {
+  return std::make_shared<InstancedShape>(geometryCore);
+}
+
+
+InstancedShape* InstancedShape::setInstances(const std::vector<glm::mat4>& transforms,
+    const std::vector<glm::vec4>& colors) {
+  assert(colors.empty() || colors.size() == transforms.size());
+  transforms_ = transforms;
+  if (colors.empty()) {
+    colors_.assign(transforms.size(), glm::vec4(1.f));
+  }
+  else {
+    colors_ = colors;
+  }
+  isInstanceDataModified_ = true;
+  invalidateBoundingBox();
+  return this;
+}
+
+
+InstancedShape* InstancedShape::addInstance(const glm::mat4& transform, const glm::vec4& color) {
+  transforms_.push_back(transform);
+  colors_.push_back(color);
+  isInstanceDataModified_ = true;
+  invalidateBoundingBox();
+  return this;
+}
+
+
+void InstancedShape::setInstanceTransform(int index, const glm::mat4& transform) {
+  assert(index >= 0 && index < getNInstances());
+  transforms_[index] = transform;
+  isInstanceDataModified_ = true;
+  invalidateBoundingBox();
+}
+
+
+const glm::mat4& InstancedShape::getInstanceTransform(int index) const {
+  assert(index >= 0 && index < getNInstances());
+  return transforms_[index];
+}
+
+
+void InstancedShape::setInstanceColor(int index, const glm::vec4& color) {
+  assert(index >= 0 && index < getNInstances());
+  colors_[index] = color;
+  isInstanceDataModified_ = true;
+}
+
+
+int InstancedShape::getNInstances() const {
+  return static_cast<int>(transforms_.size());
+}
+
+
+int InstancedShape::getNTriangles() const {
+  return Shape::getNTriangles() * getNInstances();
+}
+
+
+void InstancedShape::accept(Traverser* traverser) {
+  traverser->visitInstancedShape(this);
+}
+
+
+void InstancedShape::render(RenderState* renderState) {
+  // find geometry core, which is drawn instanced
+  GeometryCore* geometryCore = nullptr;
+  for (auto& core : cores_) {
+    if (auto candidate = dynamic_cast<GeometryCore*>(core.get())) {
+      geometryCore = candidate;
+    }
+  }
+  assert(geometryCore);
+  if (transforms_.empty()) {
+    return;
+  }
+
+  // vertex transform of geometry core has to be applied before instance transforms
+  const glm::mat4 vertexTransform = geometryCore->hasVertexTransform()
+      ? geometryCore->getVertexTransform() : glm::mat4(1.f);
+  if (isInstanceDataModified_ || vertexTransform != vertexTransform_) {
+    updateInstanceData_(vertexTransform);
+  }
+
+  for (auto& core : cores_) {
+    if (core.get() == geometryCore) {
+      // one draw call per batch, gl_InstanceID refers to the texture buffer of the batch
+      const GLsizei maxBatchInstances = getMaxBatchInstances();
+      for (GLsizei first = 0; first < getNInstances(); first += maxBatchInstances) {
+        glActiveTexture(GL_TEXTURE0 + OGLConstants::INSTANCE_DATA.texUnit);
+        glBindTexture(GL_TEXTURE_BUFFER, instanceTextures_[first / maxBatchInstances]);
+        glActiveTexture(GL_TEXTURE0);
+        geometryCore->renderInstances(renderState,
+            std::min(maxBatchInstances, getNInstances() - first));
+      }
+    }
+    else {
+      core->render(renderState);
+    }
+  }
+
+  // restore render state (material, texture, etc.)
+  postProcessCores_(renderState);
+}
+
+
+GLsizei InstancedShape::getMaxBatchInstances() {
+  static const GLsizei result = [] {
+    GLint maxTexels = 0;
+    glGetIntegerv(GL_MAX_TEXTURE_BUFFER_SIZE, &maxTexels);
+    return std::max(1, maxTexels / INSTANCE_DATA_TEXELS);
+  }();
+  return result;
+}
+
+
+void InstancedShape::createInstanceTextures_(size_t nBatches) {
+  while (instanceBuffers_.size() < nBatches) {
+    GLuint buffer = 0;
+    glGenBuffers(1, &buffer);
+    glBindBuffer(GL_TEXTURE_BUFFER, buffer);
+    assert(glIsBuffer(buffer));
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+    instanceBuffers_.push_back(buffer);
+    GLuint texture = 0;
+    glGenTextures(1, &texture);
+    glActiveTexture(GL_TEXTURE0 + OGLConstants::INSTANCE_DATA.texUnit);
+    glBindTexture(GL_TEXTURE_BUFFER, texture);
+    glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, buffer);
+    glActiveTexture(GL_TEXTURE0);
+    instanceTextures_.push_back(texture);
+  }
+
+  assert(!checkGLError());
+}
+
+
+void InstancedShape::updateInstanceData_(const glm::mat4& vertexTransform) {
+  instanceData_.resize(transforms_.size() * INSTANCE_DATA_TEXELS);
+  glm::vec4* data = instanceData_.data();
+  for (size_t i = 0; i < transforms_.size(); ++i) {
+    const glm::mat4 transform = transforms_[i] * vertexTransform;
+    const glm::mat3 normalMatrix = glm::transpose(glm::inverse(glm::mat3(transform)));
+    for (int j = 0; j < 4; ++j) {
+      *data++ = transform[j];
+    }
+    for (int j = 0; j < 3; ++j) {
+      *data++ = glm::vec4(normalMatrix[j], 0.f);
+    }
+    *data++ = colors_[i];
+  }
+
+  // split into batches that do not exceed the maximum texture buffer size
+  const size_t maxBatchTexels = static_cast<size_t>(getMaxBatchInstances()) * INSTANCE_DATA_TEXELS;
+  const size_t nBatches = (instanceData_.size() + maxBatchTexels - 1) / maxBatchTexels;
+  createInstanceTextures_(nBatches);
+  for (size_t i = 0; i < nBatches; ++i) {
+    const size_t first = i * maxBatchTexels;
+    const size_t nTexels = std::min(maxBatchTexels, instanceData_.size() - first);
+    glBindBuffer(GL_TEXTURE_BUFFER, instanceBuffers_[i]);
+    glBufferData(GL_TEXTURE_BUFFER, nTexels * sizeof(glm::vec4), instanceData_.data() + first,
+        GL_DYNAMIC_DRAW);
+  }
+  glBindBuffer(GL_TEXTURE_BUFFER, 0);
+  vertexTransform_ = vertexTransform;
+  isInstanceDataModified_ = false;
+
+  assert(!checkGLError());
+}
+
+
+BoundingBox InstancedShape::computeBoundingBox_() {
+  const BoundingBox geometryBox = Shape::computeBoundingBox_();
+  BoundingBox result;
+  for (auto& transform : transforms_) {
+    result.extend(geometryBox.transform(transform));
+  }
+  return result;
+}
+
+
+} /* namespace scg */
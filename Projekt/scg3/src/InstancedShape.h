@@ -0,0 +1,187 @@
+/**
+ * \file InstancedShape.h
+ * \brief A shape node that draws many instances of its geometry by one draw call (leaf node).
+ *
+ * \author Projektgruppe "Zahnradapparatus"
+ */
+
+/*
+ * Copyright 2026 Projektgruppe "Zahnradapparatus"
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INSTANCEDSHAPE_H_
+#define INSTANCEDSHAPE_H_
+
+#include <vector>
+#include "scg_glew.h"
+#include "scg_glm.h"
+#include "Shape.h"
+#include "scg_internals.h"
+
+namespace scg {
+
+
+/**
+ * \brief A shape node that draws many instances of its geometry by one draw call (leaf node).
+ *
+ * Each instance has its own transformation, applied before the model-view matrix of the
+ * node, and an optional color. Instance data is stored in a texture buffer, which is read
+ * by the vertex shader using gl_InstanceID (cf. phong_instanced_vert.glsl). The color is
+ * passed to the fragment shader as flat input instanceColor
+ * (cf. instance_color_modulate.glsl).
+ *
+ * Allowed core types: as for Shape, with exactly one GeometryCore, which is drawn in the
+ * order the cores have been added. The shape must be rendered with an instanced shader,
+ * which is typically set at a group node above the light nodes.
+ *
+ * Example:
+ * \code
+ * scene->addCore(shaderPhongInstanced);
+ * auto gears = InstancedShape::create();
+ * gears->addCore(matGold)
+ *      ->addCore(gearCore);
+ * gears->setInstances(transforms);
+ * light->addChild(gears);
+ * \endcode
+ *
+ * Note: The level of detail of the geometry core is selected for the model-view matrix
+ * of the node, not of each instance. The instances are drawn in batches of
+ * getMaxBatchInstances() instances, each stored in a texture buffer of its own,
+ * i.e., with one draw call per batch.
+ */
+class InstancedShape: public Shape {
+
+public:
+
+  /**
+   * Constructor.
+   */
+  InstancedShape();
+
+  /**
+   * Constructor with GeometryCore.
+   */
+  InstancedShape(GeometryCoreSP geometryCore);
+
+  /**
+   * Destructor.
+   */
+  virtual ~InstancedShape();
+
+  /**
+   * Create shared pointer.
+   */
+  static InstancedShapeSP create();
+
+  /**
+   * Create shared pointer with GeometryCore.
+   */
+  static InstancedShapeSP create(GeometryCoreSP geometryCore);
+
+  /**
+   * Set transformations and colors of all instances.
+   *
+   * \param transforms one transformation per instance
+   * \param colors one color per instance, or empty for white instances
+   * \return this pointer for method chaining
+   */
+  InstancedShape* setInstances(const std::vector<glm::mat4>& transforms,
+      const std::vector<glm::vec4>& colors = std::vector<glm::vec4>());
+
+  /**
+   * Add instance.
+   *
+   * \return this pointer for method chaining
+   */
+  InstancedShape* addInstance(const glm::mat4& transform,
+      const glm::vec4& color = glm::vec4(1.f));
+
+  /**
+   * Set transformation of one instance, e.g., for animation.
+   */
+  void setInstanceTransform(int index, const glm::mat4& transform);
+
+  /**
+   * Get transformation of one instance.
+   */
+  const glm::mat4& getInstanceTransform(int index) const;
+
+  /**
+   * Set color of one instance.
+   */
+  void setInstanceColor(int index, const glm::vec4& color);
+
+  /**
+   * Get number of instances.
+   */
+  int getNInstances() const;
+
+  /**
+   * Get approximate number of triangles of all instances.
+   */
+  virtual int getNTriangles() const;
+
+  /**
+   * Accept traverser (visitor pattern).
+   */
+  virtual void accept(Traverser* traverser);
+
+  /**
+   * Render all instances, i.e., process cores and draw geometry core instanced,
+   * with one draw call per batch.
+   */
+  virtual void render(RenderState* renderState);
+
+  /**
+   * Get maximum number of instances per draw call, limited by the maximum
+   * texture buffer size (GL_MAX_TEXTURE_BUFFER_SIZE, at least 65,536 texels with
+   * OpenGL 3.2, i.e., 8,192 instances). The limit is queried once.
+   */
+  static GLsizei getMaxBatchInstances();
+
+protected:
+
+  /**
+   * Create texture buffers for instance data until there is one per batch.
+   */
+  void createInstanceTextures_(size_t nBatches);
+
+  /**
+   * Upload instance data to texture buffers, including the vertex transform
+   * of the geometry core.
+   */
+  void updateInstanceData_(const glm::mat4& vertexTransform);
+
+  /**
+   * Compute bounding box of all instances.
+   */
+  virtual BoundingBox computeBoundingBox_();
+
+protected:
+
+  std::vector<glm::mat4> transforms_;
+  std::vector<glm::vec4> colors_;
+  std::vector<glm::vec4> instanceData_;
+  std::vector<GLuint> instanceBuffers_;     // one per batch
+  std::vector<GLuint> instanceTextures_;
+  bool isInstanceDataModified_;
+  glm::mat4 vertexTransform_;
+
+};
+
+
+} /* namespace scg */
+
+#endif /* INSTANCEDSHAPE_H_ */
@@ -22,6 +22,7 @@
  */
 
 #include "Leaf.h"
+#include "Traverser.h"
 
 namespace scg {
 
@@ -35,16 +36,11 @@ Leaf::~Leaf() {
 
 
 void Leaf::traverse(Traverser* traverser) {
-  // check if node is visible
-  if (isVisible_) {
+  // check if node is visible and not culled
+  if (isVisible_ && !traverser->isCulled(this)) {
     // process node
     accept(traverser);
   }
-
-  // recursively traverse siblings (if any)
-  if (rightSibling_) {
-    rightSibling_->traverse(traverser);
-  }
 }
 
 
@@ -0,0 +1,165 @@
+/**
+ * \file MappedFile.cpp
+ *
+ * \author Projektgruppe "Zahnradapparatus"
+ */
+
+/*
+ * Copyright 2026 Projektgruppe "Zahnradapparatus"
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include "MappedFile.h"
+
+namespace scg {
+
+
+MappedFile::MappedFile()
+    : isOpen_(false), data_(nullptr), size_(0), modificationTime_(0),
+#if defined _WIN32
+      file_(INVALID_HANDLE_VALUE), mapping_(NULL) {
+#else
+      fd_(-1) {
+#endif
+}
+
+
+MappedFile::~MappedFile() {
+  close();
+}
+
+
+bool MappedFile::open(const std::string& fileName) {
+  close();
+
+#if defined _WIN32
+  file_ = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+      OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+  if (file_ == INVALID_HANDLE_VALUE) {
+    return false;
+  }
+  LARGE_INTEGER fileSize;
+  if (!GetFileSizeEx(file_, &fileSize)) {
+    close();
+    return false;
+  }
+  size_ = static_cast<size_t>(fileSize.QuadPart);
+  FILETIME writeTime;
+  if (!GetFileTime(file_, NULL, NULL, &writeTime)) {
+    close();
+    return false;
+  }
+  modificationTime_ = (static_cast<int64_t>(writeTime.dwHighDateTime) << 32) | writeTime.dwLowDateTime;
+  if (size_ > 0) {
+    mapping_ = CreateFileMappingA(file_, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping_ == NULL) {
+      close();
+      return false;
+    }
+    data_ = static_cast<const char*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+    if (!data_) {
+      close();
+      return false;
+    }
+  }
+#else
+  fd_ = ::open(fileName.c_str(), O_RDONLY);
+  if (fd_ < 0) {
+    return false;
+  }
+  struct stat fileStat;
+  if (fstat(fd_, &fileStat) != 0) {
+    close();
+    return false;
+  }
+  size_ = static_cast<size_t>(fileStat.st_size);
+  modificationTime_ = static_cast<int64_t>(fileStat.st_mtime);
+  if (size_ > 0) {
+    void* data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+    if (data == MAP_FAILED) {
+      close();
+      return false;
+    }
+    // file is read front to back
+    madvise(data, size_, MADV_SEQUENTIAL);
+    data_ = static_cast<const char*>(data);
+  }
+#endif
+
+  isOpen_ = true;
+  return true;
+}
+
+
+void MappedFile::close() {
+#if defined _WIN32
+  if (data_) {
+    UnmapViewOfFile(data_);
+  }
+  if (mapping_ != NULL) {
+    CloseHandle(mapping_);
+    mapping_ = NULL;
+  }
+  if (file_ != INVALID_HANDLE_VALUE) {
+    CloseHandle(file_);
+    file_ = INVALID_HANDLE_VALUE;
+  }
+#else
+  if (data_) {
+    munmap(const_cast<char*>(data_), size_);
+  }
+  if (fd_ >= 0) {
+    ::close(fd_);
+    fd_ = -1;
+  }
+#endif
+  data_ = nullptr;
+  size_ = 0;
+  modificationTime_ = 0;
+  isOpen_ = false;
+}
+
+
+bool MappedFile::isOpen() const {
+  return isOpen_;
+}
+
+
+const char* MappedFile::getData() const {
+  return data_;
+}
+
+
+size_t MappedFile::getSize() const {
+  return size_;
+}
+
+
+int64_t MappedFile::getModificationTime() const {
+  return modificationTime_;
+}
+
+
+} /* namespace scg */
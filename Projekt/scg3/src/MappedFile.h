@@ -0,0 +1,113 @@
+/**
+ * \file MappedFile.h
+ * \brief A read-only memory-mapped file.
+ *
+ * \author Projektgruppe "Zahnradapparatus"
+ */
+
+/*
+ * Copyright 2026 Projektgruppe "Zahnradapparatus"
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MAPPEDFILE_H_
+#define MAPPEDFILE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "scg_internals.h"
+
+namespace scg {
+
+
+/**
+ * \brief A read-only memory-mapped file.
+ *
+ * Uses mmap() on POSIX systems and file mappings on Windows. The file contents
+ * are valid as long as the object exists and close() has not been called.
+ */
+class MappedFile {
+
+public:
+
+  /**
+   * Constructor.
+   */
+  MappedFile();
+
+  /**
+   * Destructor, closes file if open.
+   */
+  virtual ~MappedFile();
+
+  /**
+   * Map file into memory, closing a previously opened file.
+   *
+   * \return true if file has been mapped successfully
+   */
+  bool open(const std::string& fileName);
+
+  /**
+   * Unmap and close file.
+   */
+  void close();
+
+  /**
+   * Check if file is open.
+   */
+  bool isOpen() const;
+
+  /**
+   * Get pointer to mapped file contents (nullptr for empty files).
+   */
+  const char* getData() const;
+
+  /**
+   * Get file size in bytes.
+   */
+  size_t getSize() const;
+
+  /**
+   * Get time of last modification (seconds since epoch on POSIX systems,
+   * 100-nanosecond intervals since 1601 on Windows).
+   */
+  int64_t getModificationTime() const;
+
+private:
+
+  /**
+   * Disallow copy constructor and assignment operator.
+   */
+  SCG_DISALLOW_COPY_AND_ASSIGN(MappedFile);
+
+protected:
+
+  bool isOpen_;
+  const char* data_;
+  size_t size_;
+  int64_t modificationTime_;
+#if defined _WIN32
+  void* file_;
+  void* mapping_;
+#else
+  int fd_;
+#endif
+
+};
+
+
+} /* namespace scg */
+
+#endif /* MAPPEDFILE_H_ */
@@ -0,0 +1,964 @@
+/**
+ * \file MeshProcessor.cpp
+ *
+ * \author Projektgruppe "Zahnradapparatus"
+ */
+
+/*
+ * Copyright 2026 Projektgruppe "Zahnradapparatus"
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include "MeshProcessor.h"
+#include "MeshSimplifier.h"
+
+namespace scg {
+
+
+void MeshProcessor::computeSmoothNormals(MeshData& mesh, GLfloat creaseAngleDeg) {
+  const size_t nCorners = mesh.getNCorners();
+  const size_t nTriangles = nCorners / 3;
+  const bool hasTexCoords = !mesh.texCoords.empty();
+  std::vector<GLuint> identity;
+  if (mesh.indices.empty()) {
+    identity.resize(nCorners);
+    std::iota(identity.begin(), identity.end(), 0);
+  }
+  const std::vector<GLuint>& cornerVertices = mesh.indices.empty() ? identity : mesh.indices;
+
+  // triangle normals and corner angles
+  std::vector<GLfloat> triangleNormals(3 * nTriangles);
+  std::vector<GLfloat> cornerAngles(nCorners);
+  parallelFor_(nTriangles, [&](size_t begin, size_t end) {
+    computeTriangleNormals_(mesh.vertices.data(), cornerVertices.data(), begin, end,
+        triangleNormals.data(), cornerAngles.data());
+  });
+
+  // group corners by vertex position (vertices with equal position are not necessarily shared)
+  std::vector<GLuint> positionIds;
+  const size_t nPositions = findUniquePositions_(mesh.vertices, positionIds);
+  std::vector<GLuint> cornerPositions(nCorners);
+  for (size_t c = 0; c < nCorners; ++c) {
+    cornerPositions[c] = positionIds[cornerVertices[c]];
+  }
+  std::vector<GLuint> groupOffsets;
+  std::vector<GLuint> groupCorners;
+  groupCorners_(cornerPositions, nPositions, groupOffsets, groupCorners);
+
+  // average normals of adjacent triangles within crease angle
+  const GLfloat cosCreaseAngle = std::cos(glm::radians(glm::clamp(creaseAngleDeg, 0.f, 180.f)));
+  std::vector<GLfloat> cornerNormals(3 * nCorners);
+  parallelFor_(nPositions, [&](size_t begin, size_t end) {
+    // triangle normals and angles of the corners of a group, structure of arrays
+    std::vector<GLuint> triangles;
+    std::vector<GLfloat> nx, ny, nz, weights;
+    for (size_t g = begin; g < end; ++g) {
+      const size_t groupSize = groupOffsets[g + 1] - groupOffsets[g];
+      const GLuint* corners = &groupCorners[groupOffsets[g]];
+      triangles.resize(groupSize);
+      nx.resize(groupSize);
+      ny.resize(groupSize);
+      nz.resize(groupSize);
+      weights.resize(groupSize);
+      for (size_t j = 0; j < groupSize; ++j) {
+        triangles[j] = corners[j] / 3;
+        nx[j] = triangleNormals[3 * triangles[j]];
+        ny[j] = triangleNormals[3 * triangles[j] + 1];
+        nz[j] = triangleNormals[3 * triangles[j] + 2];
+        weights[j] = cornerAngles[corners[j]];
+      }
+      for (size_t i = 0; i < groupSize; ++i) {
+        GLfloat x = 0.f, y = 0.f, z = 0.f;
+        for (size_t j = 0; j < groupSize; ++j) {
+          const GLfloat cosAngle = nx[i] * nx[j] + ny[i] * ny[j] + nz[i] * nz[j];
+          const GLfloat weight = (cosAngle >= cosCreaseAngle || triangles[i] == triangles[j]) ? weights[j] : 0.f;
+          x += weight * nx[j];
+          y += weight * ny[j];
+          z += weight * nz[j];
+        }
+        const GLfloat length = std::sqrt(x * x + y * y + z * z);
+        GLfloat* normal = &cornerNormals[3 * corners[i]];
+        if (length > 0.f) {
+          normal[0] = x / length;
+          normal[1] = y / length;
+          normal[2] = z / length;
+        }
+        else {
+          normal[0] = nx[i];
+          normal[1] = ny[i];
+          normal[2] = nz[i];
+        }
+      }
+    }
+  });
+
+  if (mesh.indices.empty()) {
+    mesh.normals.swap(cornerNormals);
+  }
+  else {
+    // merge corners with equal position, texture coordinates, and normal into one vertex;
+    // first count the unique vertices of each position group
+    std::vector<GLuint> cornerSlots(nCorners);
+    std::vector<GLuint> groupVertexOffsets(nPositions + 1, 0);
+    parallelFor_(nPositions, [&](size_t begin, size_t end) {
+      std::vector<GLuint> uniqueCorners;
+      for (size_t g = begin; g < end; ++g) {
+        uniqueCorners.clear();
+        for (GLuint i = groupOffsets[g]; i < groupOffsets[g + 1]; ++i) {
+          const GLuint corner = groupCorners[i];
+          const GLfloat* normal = &cornerNormals[3 * corner];
+          const GLfloat* texCoord = hasTexCoords ? &mesh.texCoords[2 * mesh.indices[corner]] : nullptr;
+          GLuint slot = 0;
+          while (slot < uniqueCorners.size()) {
+            const GLuint other = uniqueCorners[slot];
+            const GLfloat* otherNormal = &cornerNormals[3 * other];
+            const GLfloat* otherTexCoord = hasTexCoords ? &mesh.texCoords[2 * mesh.indices[other]] : nullptr;
+            if (normal[0] == otherNormal[0] && normal[1] == otherNormal[1] && normal[2] == otherNormal[2]
+                && (!hasTexCoords || (texCoord[0] == otherTexCoord[0] && texCoord[1] == otherTexCoord[1]))) {
+              break;
+            }
+            ++slot;
+          }
+          if (slot == uniqueCorners.size()) {
+            uniqueCorners.push_back(corner);
+          }
+          cornerSlots[corner] = slot;
+        }
+        groupVertexOffsets[g + 1] = static_cast<GLuint>(uniqueCorners.size());
+      }
+    });
+    for (size_t g = 0; g < nPositions; ++g) {
+      groupVertexOffsets[g + 1] += groupVertexOffsets[g];
+    }
+
+    // then write vertices, ordered by position group
+    const size_t nNewVertices = groupVertexOffsets[nPositions];
+    std::vector<GLfloat> vertices(3 * nNewVertices);
+    std::vector<GLfloat> normals(3 * nNewVertices);
+    std::vector<GLfloat> texCoords(hasTexCoords ? 2 * nNewVertices : 0);
+    std::vector<GLuint> indices(nCorners);
+    parallelFor_(nPositions, [&](size_t begin, size_t end) {
+      for (size_t g = begin; g < end; ++g) {
+        for (GLuint i = groupOffsets[g]; i < groupOffsets[g + 1]; ++i) {
+          const GLuint corner = groupCorners[i];
+          const GLuint vertex = mesh.indices[corner];
+          const GLuint newVertex = groupVertexOffsets[g] + cornerSlots[corner];
+          memcpy(&vertices[3 * newVertex], &mesh.vertices[3 * vertex], 3 * sizeof(GLfloat));
+          memcpy(&normals[3 * newVertex], &cornerNormals[3 * corner], 3 * sizeof(GLfloat));
+          if (hasTexCoords) {
+            memcpy(&texCoords[2 * newVertex], &mesh.texCoords[2 * vertex], 2 * sizeof(GLfloat));
+          }
+          indices[corner] = newVertex;
+        }
+      }
+    });
+    mesh.vertices.swap(vertices);
+    mesh.normals.swap(normals);
+    mesh.texCoords.swap(texCoords);
+    mesh.indices.swap(indices);
+  }
+  mesh.tangents.clear();
+  mesh.binormals.clear();
+}
+
+
+void MeshProcessor::computeTangents(MeshData& mesh) {
+  assert(mesh.normals.size() == mesh.vertices.size());
+
+  // arbitrary tangent orthogonal to normal
+  auto orthogonalTangent = [](const glm::vec3& normal) -> glm::vec3 {
+    glm::vec3 axis = (std::abs(normal.x) < 0.9f) ? glm::vec3(1.f, 0.f, 0.f) : glm::vec3(0.f, 1.f, 0.f);
+    return glm::normalize(axis - glm::dot(normal, axis) * normal);
+  };
+
+  if (mesh.texCoords.empty()) {
+    const size_t nVertices = mesh.getNVertices();
+    mesh.tangents.resize(3 * nVertices);
+    mesh.binormals.resize(3 * nVertices);
+    parallelFor_(nVertices, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        const glm::vec3 normal = glm::make_vec3(&mesh.normals[3 * i]);
+        const glm::vec3 tangent = orthogonalTangent(normal);
+        const glm::vec3 binormal = glm::cross(normal, tangent);
+        memcpy(&mesh.tangents[3 * i], glm::value_ptr(tangent), 3 * sizeof(GLfloat));
+        memcpy(&mesh.binormals[3 * i], glm::value_ptr(binormal), 3 * sizeof(GLfloat));
+      }
+    });
+    return;
+  }
+
+  const size_t nCorners = mesh.getNCorners();
+  const size_t nTriangles = nCorners / 3;
+  std::vector<GLuint> identity;
+  if (mesh.indices.empty()) {
+    identity.resize(nCorners);
+    std::iota(identity.begin(), identity.end(), 0);
+  }
+  const std::vector<GLuint>& cornerVertices = mesh.indices.empty() ? identity : mesh.indices;
+
+  // triangle normals, corner angles, and triangle tangent frames
+  std::vector<GLfloat> triangleNormals(3 * nTriangles);
+  std::vector<GLfloat> cornerAngles(nCorners);
+  std::vector<GLfloat> triangleTangents(3 * nTriangles);
+  std::vector<GLfloat> triangleBinormals(3 * nTriangles);
+  parallelFor_(nTriangles, [&](size_t begin, size_t end) {
+    computeTriangleNormals_(mesh.vertices.data(), cornerVertices.data(), begin, end,
+        triangleNormals.data(), cornerAngles.data());
+    computeTriangleTangents_(mesh.vertices.data(), mesh.texCoords.data(), cornerVertices.data(),
+        begin, end, triangleTangents.data(), triangleBinormals.data());
+  });
+
+  // split vertices used by triangles with both regular and mirrored texture coordinates
+  if (!mesh.indices.empty()) {
+    const GLuint REGULAR = 1;
+    const GLuint MIRRORED = 2;
+    std::vector<unsigned char> triangleOrientations(nTriangles);
+    for (size_t t = 0; t < nTriangles; ++t) {
+      const glm::vec3 tangent = glm::make_vec3(&triangleTangents[3 * t]);
+      const glm::vec3 binormal = glm::make_vec3(&triangleBinormals[3 * t]);
+      const glm::vec3 normal = glm::make_vec3(&triangleNormals[3 * t]);
+      const GLfloat orientation = glm::dot(normal, glm::cross(tangent, binormal));
+      triangleOrientations[t] = (orientation > 0.f) ? REGULAR : (orientation < 0.f) ? MIRRORED : 0;
+    }
+    std::vector<unsigned char> vertexOrientations(mesh.getNVertices(), 0);
+    for (size_t c = 0; c < nCorners; ++c) {
+      vertexOrientations[mesh.indices[c]] |= triangleOrientations[c / 3];
+    }
+    const GLuint NONE = static_cast<GLuint>(-1);
+    std::vector<GLuint> mirroredVertices(mesh.getNVertices(), NONE);
+    for (size_t c = 0; c < nCorners; ++c) {
+      const GLuint vertex = mesh.indices[c];
+      if (vertexOrientations[vertex] == (REGULAR | MIRRORED)
+          && triangleOrientations[c / 3] == MIRRORED) {
+        if (mirroredVertices[vertex] == NONE) {
+          mirroredVertices[vertex] = static_cast<GLuint>(mesh.getNVertices());
+          for (int k = 0; k < 3; ++k) {
+            const GLfloat vertexValue = mesh.vertices[3 * vertex + k];
+            const GLfloat normalValue = mesh.normals[3 * vertex + k];
+            mesh.vertices.push_back(vertexValue);
+            mesh.normals.push_back(normalValue);
+          }
+          for (int k = 0; k < 2; ++k) {
+            const GLfloat texCoordValue = mesh.texCoords[2 * vertex + k];
+            mesh.texCoords.push_back(texCoordValue);
+          }
+        }
+        mesh.indices[c] = mirroredVertices[vertex];
+      }
+    }
+  }
+
+  // average tangent frames of adjacent triangles and orthogonalize
+  const size_t nVertices = mesh.getNVertices();
+  std::vector<GLuint> groupOffsets;
+  std::vector<GLuint> groupCorners;
+  groupCorners_(cornerVertices, nVertices, groupOffsets, groupCorners);
+  mesh.tangents.resize(3 * nVertices);
+  mesh.binormals.resize(3 * nVertices);
+  parallelFor_(nVertices, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      glm::vec3 sumTangent(0.f);
+      glm::vec3 sumBinormal(0.f);
+      for (GLuint j = groupOffsets[i]; j < groupOffsets[i + 1]; ++j) {
+        const GLuint corner = groupCorners[j];
+        sumTangent += cornerAngles[corner] * glm::make_vec3(&triangleTangents[3 * (corner / 3)]);
+        sumBinormal += cornerAngles[corner] * glm::make_vec3(&triangleBinormals[3 * (corner / 3)]);
+      }
+      const glm::vec3 normal = glm::make_vec3(&mesh.normals[3 * i]);
+      glm::vec3 tangent = sumTangent - glm::dot(normal, sumTangent) * normal;
+      const GLfloat length = glm::length(tangent);
+      tangent = (length > 1e-6f) ? tangent / length : orthogonalTangent(normal);
+      glm::vec3 binormal = glm::cross(normal, tangent);
+      if (glm::dot(binormal, sumBinormal) < 0.f) {
+        binormal = -binormal;
+      }
+      memcpy(&mesh.tangents[3 * i], glm::value_ptr(tangent), 3 * sizeof(GLfloat));
+      memcpy(&mesh.binormals[3 * i], glm::value_ptr(binormal), 3 * sizeof(GLfloat));
+    }
+  });
+}
+
+
+void MeshProcessor::buildLODChain(MeshData& mesh, const std::vector<GLfloat>& ratios) {
+  mesh.lodLevels.clear();
+  const size_t nTriangles = mesh.indices.size() / 3;
+  if (nTriangles == 0) {
+    return;
+  }
+
+  // level 0: original triangles
+  MeshData::LODLevel level;
+  level.first = 0;
+  level.count = static_cast<GLuint>(mesh.indices.size());
+  level.error = 0.f;
+  for (auto& range : mesh.drawRanges) {
+    level.rangeCounts.push_back(range.count);
+  }
+  mesh.lodLevels.push_back(level);
+
+  // simplify incrementally, from the finest to the coarsest level
+  std::vector<GLfloat> sortedRatios(ratios);
+  std::sort(sortedRatios.begin(), sortedRatios.end(), std::greater<GLfloat>());
+  MeshSimplifier simplifier(mesh);
+  std::vector<GLuint> levelIndices;
+  for (auto ratio : sortedRatios) {
+    if (ratio >= 1.f || ratio < 0.f) {
+      continue;
+    }
+    simplifier.simplify(static_cast<size_t>(ratio * nTriangles));
+    levelIndices.clear();
+    simplifier.getTriangles(levelIndices, level.rangeCounts);
+    if (levelIndices.size() >= mesh.lodLevels.back().count) {
+      // no further simplification possible
+      break;
+    }
+    level.first = static_cast<GLuint>(mesh.indices.size());
+    level.count = static_cast<GLuint>(levelIndices.size());
+    level.error = simplifier.getError();
+    mesh.indices.insert(mesh.indices.end(), levelIndices.begin(), levelIndices.end());
+    mesh.lodLevels.push_back(level);
+  }
+  if (mesh.lodLevels.size() == 1) {
+    mesh.lodLevels.clear();
+  }
+}
+
+
+void MeshProcessor::optimizeMesh(MeshData& mesh) {
+  if (mesh.indices.empty()) {
+    return;
+  }
+  const size_t nVertices = mesh.getNVertices();
+
+  // collect index ranges that must stay contiguous: draw ranges of each level of detail
+  std::vector<std::pair<GLuint, GLuint>> ranges;
+  if (mesh.lodLevels.empty()) {
+    if (mesh.drawRanges.empty()) {
+      ranges.push_back(std::make_pair(0u, static_cast<GLuint>(mesh.indices.size())));
+    }
+    for (auto& range : mesh.drawRanges) {
+      ranges.push_back(std::make_pair(range.first, range.count));
+    }
+  }
+  for (auto& level : mesh.lodLevels) {
+    if (level.rangeCounts.empty()) {
+      ranges.push_back(std::make_pair(level.first, level.count));
+    }
+    GLuint first = level.first;
+    for (GLuint count : level.rangeCounts) {
+      ranges.push_back(std::make_pair(first, count));
+      first += count;
+    }
+  }
+
+  // reorder triangles within each range
+  for (auto& range : ranges) {
+    GLuint* indices = mesh.indices.data() + range.first;
+    optimizeVertexCache(indices, range.second, nVertices);
+    optimizeOverdraw(indices, range.second, mesh.vertices.data(), nVertices);
+  }
+
+  // reorder vertices
+  std::vector<GLuint> vertexOrder;
+  optimizeVertexFetch(mesh.indices.data(), mesh.indices.size(), nVertices, vertexOrder);
+  remapVertexAttribute(mesh.vertices.data(), 3, vertexOrder);
+  if (!mesh.normals.empty()) {
+    remapVertexAttribute(mesh.normals.data(), 3, vertexOrder);
+  }
+  if (!mesh.tangents.empty()) {
+    remapVertexAttribute(mesh.tangents.data(), 3, vertexOrder);
+  }
+  if (!mesh.binormals.empty()) {
+    remapVertexAttribute(mesh.binormals.data(), 3, vertexOrder);
+  }
+  if (!mesh.texCoords.empty()) {
+    remapVertexAttribute(mesh.texCoords.data(), 2, vertexOrder);
+  }
+}
+
+
+void MeshProcessor::optimizeVertexCache(GLuint* indices, size_t nIndices, size_t nVertices) {
+  const size_t nTriangles = nIndices / 3;
+  if (nTriangles < 2) {
+    return;
+  }
+  const GLuint noVertex = ~0u;
+
+  // triangles adjacent to each vertex and number of adjacent triangles not yet emitted
+  std::vector<GLuint> cornerKeys(indices, indices + 3 * nTriangles);
+  std::vector<GLuint> vertexOffsets;
+  std::vector<GLuint> vertexCorners;
+  groupCorners_(cornerKeys, nVertices, vertexOffsets, vertexCorners);
+  std::vector<GLuint> liveCounts(nVertices);
+  for (size_t v = 0; v < nVertices; ++v) {
+    liveCounts[v] = vertexOffsets[v + 1] - vertexOffsets[v];
+  }
+
+  std::vector<size_t> cacheTimes(nVertices, 0);
+  std::vector<char> isEmitted(nTriangles, 0);
+  std::vector<GLuint> deadEnds;
+  std::vector<GLuint> candidates;
+  std::vector<GLuint> result;
+  result.reserve(3 * nTriangles);
+  size_t time = VERTEX_CACHE_SIZE + 1;
+  size_t cursor = 0;
+  GLuint fanVertex = indices[0];
+  while (fanVertex != noVertex) {
+
+    // emit all remaining triangles adjacent to the fanning vertex
+    candidates.clear();
+    for (GLuint k = vertexOffsets[fanVertex]; k < vertexOffsets[fanVertex + 1]; ++k) {
+      const GLuint triangle = vertexCorners[k] / 3;
+      if (isEmitted[triangle]) {
+        continue;
+      }
+      isEmitted[triangle] = 1;
+      for (int i = 0; i < 3; ++i) {
+        const GLuint v = indices[3 * triangle + i];
+        result.push_back(v);
+        deadEnds.push_back(v);
+        candidates.push_back(v);
+        --liveCounts[v];
+        if (time - cacheTimes[v] > VERTEX_CACHE_SIZE) {
+          cacheTimes[v] = time++;
+        }
+      }
+    }
+
+    // next fanning vertex: oldest candidate that stays in the cache while its fan is emitted
+    fanVertex = noVertex;
+    size_t maxPriority = 0;
+    for (GLuint v : candidates) {
+      if (liveCounts[v] == 0) {
+        continue;
+      }
+      size_t priority = 1;
+      if (time - cacheTimes[v] + 2 * liveCounts[v] <= VERTEX_CACHE_SIZE) {
+        priority += time - cacheTimes[v];
+      }
+      if (priority > maxPriority) {
+        maxPriority = priority;
+        fanVertex = v;
+      }
+    }
+
+    // dead end: use the most recent vertex with remaining triangles, or the next one in input order
+    while (fanVertex == noVertex && !deadEnds.empty()) {
+      const GLuint v = deadEnds.back();
+      deadEnds.pop_back();
+      if (liveCounts[v] > 0) {
+        fanVertex = v;
+      }
+    }
+    for (; fanVertex == noVertex && cursor < nVertices; ++cursor) {
+      if (liveCounts[cursor] > 0) {
+        fanVertex = static_cast<GLuint>(cursor);
+      }
+    }
+  }
+  assert(result.size() == 3 * nTriangles);
+
+  // keep the given order if it is better already (e.g., regular grids)
+  if (analyzeVertexCache(result.data(), result.size(), nVertices).acmr
+      < analyzeVertexCache(indices, 3 * nTriangles, nVertices).acmr) {
+    std::copy(result.begin(), result.end(), indices);
+  }
+}
+
+
+void MeshProcessor::optimizeOverdraw(GLuint* indices, size_t nIndices, const GLfloat* vertices,
+    size_t nVertices, GLfloat threshold) {
+  const size_t nTriangles = nIndices / 3;
+  if (nTriangles < 2) {
+    return;
+  }
+
+  // miss ratio of the given triangle order
+  std::vector<size_t> cacheTimes(nVertices, 0);
+  size_t time = VERTEX_CACHE_SIZE;
+  size_t nMisses = 0;
+  for (size_t t = 0; t < nTriangles; ++t) {
+    nMisses += simulateVertexCache_(indices + 3 * t, cacheTimes, time);
+  }
+  const double maxRatio = threshold * static_cast<double>(nMisses) / nTriangles;
+
+  // clusters: start a new cluster with a flushed cache as soon as the miss ratio of
+  // the current cluster is low enough, such that the clusters can be drawn in any order
+  std::vector<size_t> clusterStarts(1, 0);
+  size_t clusterMisses = 0;
+  time += VERTEX_CACHE_SIZE;
+  for (size_t t = 0; t < nTriangles; ++t) {
+    clusterMisses += simulateVertexCache_(indices + 3 * t, cacheTimes, time);
+    if (clusterMisses <= maxRatio * (t + 1 - clusterStarts.back())) {
+      clusterStarts.push_back(t + 1);
+      clusterMisses = 0;
+      time += VERTEX_CACHE_SIZE;
+    }
+  }
+
+  // remove end of the last cluster or append the remaining triangles, whose miss ratio is too high,
+  // to the last cluster
+  if (clusterStarts.size() > 1) {
+    clusterStarts.pop_back();
+  }
+  const size_t nClusters = clusterStarts.size();
+  clusterStarts.push_back(nTriangles);
+  if (nClusters < 2) {
+    return;
+  }
+
+  // area-weighted centroids and normals of clusters and mesh
+  std::vector<glm::vec3> clusterCentroids(nClusters, glm::vec3(0.f));
+  std::vector<glm::vec3> clusterNormals(nClusters, glm::vec3(0.f));
+  std::vector<GLfloat> clusterAreas(nClusters, 0.f);
+  glm::vec3 meshCentroid(0.f);
+  GLfloat meshArea = 0.f;
+  for (size_t c = 0; c < nClusters; ++c) {
+    for (size_t t = clusterStarts[c]; t < clusterStarts[c + 1]; ++t) {
+      const glm::vec3 p0 = glm::make_vec3(vertices + 3 * indices[3 * t]);
+      const glm::vec3 p1 = glm::make_vec3(vertices + 3 * indices[3 * t + 1]);
+      const glm::vec3 p2 = glm::make_vec3(vertices + 3 * indices[3 * t + 2]);
+      const glm::vec3 normal = glm::cross(p1 - p0, p2 - p0);   // length: twice the area
+      const GLfloat area = glm::length(normal);
+      clusterCentroids[c] += area * (p0 + p1 + p2);
+      clusterNormals[c] += normal;
+      clusterAreas[c] += area;
+    }
+    meshCentroid += clusterCentroids[c];
+    meshArea += clusterAreas[c];
+  }
+  if (meshArea <= 0.f) {
+    return;
+  }
+  meshCentroid /= 3.f * meshArea;
+
+  // sort clusters by descending sort key
+  std::vector<GLfloat> sortKeys(nClusters, 0.f);
+  for (size_t c = 0; c < nClusters; ++c) {
+    const GLfloat normalLength = glm::length(clusterNormals[c]);
+    if (clusterAreas[c] > 0.f && normalLength > 0.f) {
+      const glm::vec3 centroid = clusterCentroids[c] / (3.f * clusterAreas[c]);
+      sortKeys[c] = glm::dot(centroid - meshCentroid, clusterNormals[c]) / normalLength;
+    }
+  }
+  std::vector<size_t> clusterOrder(nClusters);
+  std::iota(clusterOrder.begin(), clusterOrder.end(), static_cast<size_t>(0));
+  std::stable_sort(clusterOrder.begin(), clusterOrder.end(),
+      [&sortKeys](size_t a, size_t b) { return sortKeys[a] > sortKeys[b]; });
+
+  std::vector<GLuint> result;
+  result.reserve(3 * nTriangles);
+  for (size_t c : clusterOrder) {
+    result.insert(result.end(), indices + 3 * clusterStarts[c], indices + 3 * clusterStarts[c + 1]);
+  }
+  std::copy(result.begin(), result.end(), indices);
+}
+
+
+void MeshProcessor::optimizeVertexFetch(GLuint* indices, size_t nIndices, size_t nVertices,
+    std::vector<GLuint>& vertexOrder) {
+  const GLuint noVertex = ~0u;
+  std::vector<GLuint> newIndices(nVertices, noVertex);
+  vertexOrder.clear();
+  vertexOrder.reserve(nVertices);
+  for (size_t i = 0; i < nIndices; ++i) {
+    GLuint& newIndex = newIndices[indices[i]];
+    if (newIndex == noVertex) {
+      newIndex = static_cast<GLuint>(vertexOrder.size());
+      vertexOrder.push_back(indices[i]);
+    }
+    indices[i] = newIndex;
+  }
+  for (size_t v = 0; v < nVertices; ++v) {
+    if (newIndices[v] == noVertex) {
+      vertexOrder.push_back(static_cast<GLuint>(v));
+    }
+  }
+}
+
+
+void MeshProcessor::remapVertexAttribute(GLfloat* data, size_t size,
+    const std::vector<GLuint>& vertexOrder) {
+  std::vector<GLfloat> oldData(data, data + size * vertexOrder.size());
+  for (size_t v = 0; v < vertexOrder.size(); ++v) {
+    std::memcpy(data + size * v, oldData.data() + size * vertexOrder[v], size * sizeof(GLfloat));
+  }
+}
+
+
+VertexCacheStatistics MeshProcessor::analyzeVertexCache(const GLuint* indices, size_t nIndices,
+    size_t nVertices) {
+  VertexCacheStatistics stats;
+  stats.acmr = 0.f;
+  stats.atvr = 0.f;
+  const size_t nTriangles = nIndices / 3;
+  if (nTriangles == 0) {
+    return stats;
+  }
+  std::vector<size_t> cacheTimes(nVertices, 0);
+  size_t time = VERTEX_CACHE_SIZE;
+  size_t nMisses = 0;
+  for (size_t t = 0; t < nTriangles; ++t) {
+    nMisses += simulateVertexCache_(indices + 3 * t, cacheTimes, time);
+  }
+  std::vector<char> isReferenced(nVertices, 0);
+  size_t nReferenced = 0;
+  for (size_t i = 0; i < 3 * nTriangles; ++i) {
+    if (!isReferenced[indices[i]]) {
+      isReferenced[indices[i]] = 1;
+      ++nReferenced;
+    }
+  }
+  stats.acmr = static_cast<GLfloat>(nMisses) / nTriangles;
+  stats.atvr = static_cast<GLfloat>(nMisses) / nReferenced;
+  return stats;
+}
+
+
+glm::mat4 MeshProcessor::quantizePositions(const GLfloat* vertices, size_t nVertices,
+    std::vector<GLushort>& quantized) {
+  glm::vec3 boundsMin(FLT_MAX);
+  glm::vec3 boundsMax(-FLT_MAX);
+  for (size_t v = 0; v < nVertices; ++v) {
+    const glm::vec3 p = glm::make_vec3(vertices + 3 * v);
+    boundsMin = glm::min(boundsMin, p);
+    boundsMax = glm::max(boundsMax, p);
+  }
+  if (nVertices == 0) {
+    boundsMin = boundsMax = glm::vec3(0.f);
+  }
+  GLfloat extent = std::max(boundsMax.x - boundsMin.x,
+      std::max(boundsMax.y - boundsMin.y, boundsMax.z - boundsMin.z));
+  if (extent <= 0.f) {
+    extent = 1.f;
+  }
+
+  const GLfloat maxValue = 65535.f;
+  quantized.resize(4 * nVertices);
+  for (size_t v = 0; v < nVertices; ++v) {
+    const glm::vec3 p = (glm::make_vec3(vertices + 3 * v) - boundsMin) / extent;
+    for (int i = 0; i < 3; ++i) {
+      quantized[4 * v + i] = static_cast<GLushort>(
+          glm::clamp(p[i], 0.f, 1.f) * maxValue + 0.5f);
+    }
+    quantized[4 * v + 3] = static_cast<GLushort>(maxValue);
+  }
+  return glm::scale(glm::translate(glm::mat4(1.f), boundsMin), glm::vec3(extent));
+}
+
+
+void MeshProcessor::packDirections(const GLfloat* directions, const GLfloat* signs, size_t nVertices,
+    std::vector<GLuint>& packed) {
+  packed.resize(nVertices);
+  for (size_t v = 0; v < nVertices; ++v) {
+    GLuint value = 0;
+    for (int i = 0; i < 3; ++i) {
+      const GLint component = static_cast<GLint>(
+          std::floor(glm::clamp(directions[3 * v + i], -1.f, 1.f) * 511.f + 0.5f));
+      value |= (static_cast<GLuint>(component) & 0x3ffu) << (10 * i);
+    }
+    if (signs) {
+      value |= (signs[v] < 0.f ? 0x3u : 0x1u) << 30;
+    }
+    packed[v] = value;
+  }
+}
+
+
+void MeshProcessor::packDirections(const GLfloat* directions, const GLfloat* signs, size_t nVertices,
+    std::vector<GLshort>& packed) {
+  packed.resize(4 * nVertices);
+  for (size_t v = 0; v < nVertices; ++v) {
+    for (int i = 0; i < 3; ++i) {
+      packed[4 * v + i] = static_cast<GLshort>(
+          std::floor(glm::clamp(directions[3 * v + i], -1.f, 1.f) * 32767.f + 0.5f));
+    }
+    packed[4 * v + 3] = signs ? (signs[v] < 0.f ? -32767 : 32767) : 0;
+  }
+}
+
+
+void MeshProcessor::computeTangentSigns(const GLfloat* normals, const GLfloat* tangents,
+    const GLfloat* binormals, size_t nVertices, std::vector<GLfloat>& signs) {
+  signs.resize(nVertices);
+  for (size_t v = 0; v < nVertices; ++v) {
+    const glm::vec3 normal = glm::make_vec3(normals + 3 * v);
+    const glm::vec3 tangent = glm::make_vec3(tangents + 3 * v);
+    const glm::vec3 binormal = glm::make_vec3(binormals + 3 * v);
+    signs[v] = (glm::dot(glm::cross(normal, tangent), binormal) < 0.f) ? -1.f : 1.f;
+  }
+}
+
+
+void MeshProcessor::packHalfFloats(const GLfloat* data, size_t size, size_t nVertices,
+    std::vector<GLushort>& packed) {
+  const size_t paddedSize = getPaddedHalfFloatSize(size);
+  packed.resize(paddedSize * nVertices);
+  for (size_t v = 0; v < nVertices; ++v) {
+    for (size_t i = 0; i < paddedSize; ++i) {
+      const GLfloat value = (i < size) ? data[size * v + i] : (i == 3 ? 1.f : 0.f);
+      packed[paddedSize * v + i] = static_cast<GLushort>(glm::packHalf1x16(value));
+    }
+  }
+}
+
+
+void MeshProcessor::computeTriangleNormals_(const GLfloat* vertices, const GLuint* indices,
+    size_t begin, size_t end, GLfloat* triangleNormals, GLfloat* cornerAngles) {
+
+  // angle between two vectors, given their dot product and the product of their lengths
+  auto angle = [](GLfloat dot, GLfloat lengthProduct) -> GLfloat {
+    return std::acos(std::min(1.f, std::max(-1.f, dot / std::max(lengthProduct, FLT_MIN))));
+  };
+
+  // edge vectors a = p1 - p0, b = p2 - p0, c = p2 - p1 of a block of triangles
+  GLfloat ax[BLOCK_SIZE], ay[BLOCK_SIZE], az[BLOCK_SIZE];
+  GLfloat bx[BLOCK_SIZE], by[BLOCK_SIZE], bz[BLOCK_SIZE];
+  GLfloat cx[BLOCK_SIZE], cy[BLOCK_SIZE], cz[BLOCK_SIZE];
+  GLfloat nx[BLOCK_SIZE], ny[BLOCK_SIZE], nz[BLOCK_SIZE];
+  GLfloat angle0[BLOCK_SIZE], angle1[BLOCK_SIZE], angle2[BLOCK_SIZE];
+
+  for (size_t blockBegin = begin; blockBegin < end; blockBegin += BLOCK_SIZE) {
+    const size_t n = std::min(end - blockBegin, static_cast<size_t>(BLOCK_SIZE));
+
+    // gather vertex positions
+    for (size_t i = 0; i < n; ++i) {
+      const GLuint* triangle = &indices[3 * (blockBegin + i)];
+      const GLfloat* p0 = &vertices[3 * triangle[0]];
+      const GLfloat* p1 = &vertices[3 * triangle[1]];
+      const GLfloat* p2 = &vertices[3 * triangle[2]];
+      ax[i] = p1[0] - p0[0];
+      ay[i] = p1[1] - p0[1];
+      az[i] = p1[2] - p0[2];
+      bx[i] = p2[0] - p0[0];
+      by[i] = p2[1] - p0[1];
+      bz[i] = p2[2] - p0[2];
+      cx[i] = p2[0] - p1[0];
+      cy[i] = p2[1] - p1[1];
+      cz[i] = p2[2] - p1[2];
+    }
+
+    // normals and angles, branch-free on contiguous arrays
+    for (size_t i = 0; i < n; ++i) {
+      const GLfloat x = ay[i] * bz[i] - az[i] * by[i];
+      const GLfloat y = az[i] * bx[i] - ax[i] * bz[i];
+      const GLfloat z = ax[i] * by[i] - ay[i] * bx[i];
+      const GLfloat length = std::sqrt(x * x + y * y + z * z);
+      const GLfloat invLength = (length > 0.f) ? 1.f / length : 0.f;
+      nx[i] = x * invLength;
+      ny[i] = y * invLength;
+      nz[i] = z * invLength;
+      const GLfloat lengthA = std::sqrt(ax[i] * ax[i] + ay[i] * ay[i] + az[i] * az[i]);
+      const GLfloat lengthB = std::sqrt(bx[i] * bx[i] + by[i] * by[i] + bz[i] * bz[i]);
+      const GLfloat lengthC = std::sqrt(cx[i] * cx[i] + cy[i] * cy[i] + cz[i] * cz[i]);
+      angle0[i] = angle(ax[i] * bx[i] + ay[i] * by[i] + az[i] * bz[i], lengthA * lengthB);
+      angle1[i] = angle(-ax[i] * cx[i] - ay[i] * cy[i] - az[i] * cz[i], lengthA * lengthC);
+      angle2[i] = angle(bx[i] * cx[i] + by[i] * cy[i] + bz[i] * cz[i], lengthB * lengthC);
+    }
+
+    // scatter results
+    for (size_t i = 0; i < n; ++i) {
+      const size_t t = blockBegin + i;
+      triangleNormals[3 * t] = nx[i];
+      triangleNormals[3 * t + 1] = ny[i];
+      triangleNormals[3 * t + 2] = nz[i];
+      cornerAngles[3 * t] = angle0[i];
+      cornerAngles[3 * t + 1] = angle1[i];
+      cornerAngles[3 * t + 2] = angle2[i];
+    }
+  }
+}
+
+
+void MeshProcessor::computeTriangleTangents_(const GLfloat* vertices, const GLfloat* texCoords,
+    const GLuint* indices, size_t begin, size_t end, GLfloat* triangleTangents,
+    GLfloat* triangleBinormals) {
+
+  // edge vectors e1 = p1 - p0, e2 = p2 - p0 and texture coordinate differences of a block of triangles
+  GLfloat e1x[BLOCK_SIZE], e1y[BLOCK_SIZE], e1z[BLOCK_SIZE];
+  GLfloat e2x[BLOCK_SIZE], e2y[BLOCK_SIZE], e2z[BLOCK_SIZE];
+  GLfloat ds1[BLOCK_SIZE], dt1[BLOCK_SIZE], ds2[BLOCK_SIZE], dt2[BLOCK_SIZE];
+  GLfloat tx[BLOCK_SIZE], ty[BLOCK_SIZE], tz[BLOCK_SIZE];
+  GLfloat bx[BLOCK_SIZE], by[BLOCK_SIZE], bz[BLOCK_SIZE];
+
+  for (size_t blockBegin = begin; blockBegin < end; blockBegin += BLOCK_SIZE) {
+    const size_t n = std::min(end - blockBegin, static_cast<size_t>(BLOCK_SIZE));
+
+    // gather vertex positions and texture coordinates
+    for (size_t i = 0; i < n; ++i) {
+      const GLuint* triangle = &indices[3 * (blockBegin + i)];
+      const GLfloat* p0 = &vertices[3 * triangle[0]];
+      const GLfloat* p1 = &vertices[3 * triangle[1]];
+      const GLfloat* p2 = &vertices[3 * triangle[2]];
+      const GLfloat* uv0 = &texCoords[2 * triangle[0]];
+      const GLfloat* uv1 = &texCoords[2 * triangle[1]];
+      const GLfloat* uv2 = &texCoords[2 * triangle[2]];
+      e1x[i] = p1[0] - p0[0];
+      e1y[i] = p1[1] - p0[1];
+      e1z[i] = p1[2] - p0[2];
+      e2x[i] = p2[0] - p0[0];
+      e2y[i] = p2[1] - p0[1];
+      e2z[i] = p2[2] - p0[2];
+      ds1[i] = uv1[0] - uv0[0];
+      dt1[i] = uv1[1] - uv0[1];
+      ds2[i] = uv2[0] - uv0[0];
+      dt2[i] = uv2[1] - uv0[1];
+    }
+
+    // solve e1 = ds1 * T + dt1 * B, e2 = ds2 * T + dt2 * B, then normalize T and B
+    for (size_t i = 0; i < n; ++i) {
+      const GLfloat det = ds1[i] * dt2[i] - ds2[i] * dt1[i];
+      const GLfloat invDet = (std::abs(det) > FLT_MIN) ? 1.f / det : 0.f;
+      const GLfloat x1 = (e1x[i] * dt2[i] - e2x[i] * dt1[i]) * invDet;
+      const GLfloat y1 = (e1y[i] * dt2[i] - e2y[i] * dt1[i]) * invDet;
+      const GLfloat z1 = (e1z[i] * dt2[i] - e2z[i] * dt1[i]) * invDet;
+      const GLfloat x2 = (e2x[i] * ds1[i] - e1x[i] * ds2[i]) * invDet;
+      const GLfloat y2 = (e2y[i] * ds1[i] - e1y[i] * ds2[i]) * invDet;
+      const GLfloat z2 = (e2z[i] * ds1[i] - e1z[i] * ds2[i]) * invDet;
+      const GLfloat length1 = std::sqrt(x1 * x1 + y1 * y1 + z1 * z1);
+      const GLfloat length2 = std::sqrt(x2 * x2 + y2 * y2 + z2 * z2);
+      const GLfloat invLength1 = (length1 > 0.f) ? 1.f / length1 : 0.f;
+      const GLfloat invLength2 = (length2 > 0.f) ? 1.f / length2 : 0.f;
+      tx[i] = x1 * invLength1;
+      ty[i] = y1 * invLength1;
+      tz[i] = z1 * invLength1;
+      bx[i] = x2 * invLength2;
+      by[i] = y2 * invLength2;
+      bz[i] = z2 * invLength2;
+    }
+
+    // scatter results
+    for (size_t i = 0; i < n; ++i) {
+      const size_t t = blockBegin + i;
+      triangleTangents[3 * t] = tx[i];
+      triangleTangents[3 * t + 1] = ty[i];
+      triangleTangents[3 * t + 2] = tz[i];
+      triangleBinormals[3 * t] = bx[i];
+      triangleBinormals[3 * t + 1] = by[i];
+      triangleBinormals[3 * t + 2] = bz[i];
+    }
+  }
+}
+
+
+size_t MeshProcessor::findUniquePositions_(const std::vector<GLfloat>& vertices,
+    std::vector<GLuint>& positionIds) {
+  const size_t nVertices = vertices.size() / 3;
+  positionIds.resize(nVertices);
+
+  // open addressing hash table of vertex indices, at most half full
+  const GLuint NONE = static_cast<GLuint>(-1);
+  size_t tableSize = 16;
+  while (tableSize < 2 * nVertices) {
+    tableSize *= 2;
+  }
+  std::vector<GLuint> table(tableSize, NONE);
+  size_t nPositions = 0;
+  for (size_t i = 0; i < nVertices; ++i) {
+    const GLfloat* position = &vertices[3 * i];
+    // FNV-1a on float bit patterns, -0 and +0 are equal
+    uint64_t hash = 14695981039346656037ULL;
+    for (int k = 0; k < 3; ++k) {
+      const GLfloat value = position[k] + 0.f;
+      uint32_t bits;
+      memcpy(&bits, &value, sizeof(bits));
+      hash = (hash ^ bits) * 1099511628211ULL;
+    }
+    size_t slot = static_cast<size_t>(hash ^ (hash >> 32)) & (tableSize - 1);
+    while (table[slot] != NONE) {
+      const GLfloat* other = &vertices[3 * table[slot]];
+      if (position[0] == other[0] && position[1] == other[1] && position[2] == other[2]) {
+        break;
+      }
+      slot = (slot + 1) & (tableSize - 1);
+    }
+    if (table[slot] == NONE) {
+      table[slot] = static_cast<GLuint>(i);
+      positionIds[i] = static_cast<GLuint>(nPositions++);
+    }
+    else {
+      positionIds[i] = positionIds[table[slot]];
+    }
+  }
+  return nPositions;
+}
+
+
+void MeshProcessor::groupCorners_(const std::vector<GLuint>& cornerKeys, size_t nKeys,
+    std::vector<GLuint>& groupOffsets, std::vector<GLuint>& groupCorners) {
+  groupOffsets.assign(nKeys + 1, 0);
+  for (GLuint key : cornerKeys) {
+    ++groupOffsets[key + 1];
+  }
+  for (size_t i = 0; i < nKeys; ++i) {
+    groupOffsets[i + 1] += groupOffsets[i];
+  }
+  std::vector<GLuint> nextCorner(groupOffsets.begin(), groupOffsets.end() - 1);
+  groupCorners.resize(cornerKeys.size());
+  for (size_t c = 0; c < cornerKeys.size(); ++c) {
+    groupCorners[nextCorner[cornerKeys[c]]++] = static_cast<GLuint>(c);
+  }
+}
+
+
+unsigned int MeshProcessor::simulateVertexCache_(const GLuint* triangle,
+    std::vector<size_t>& insertTimes, size_t& time) {
+  unsigned int nMisses = 0;
+  for (int i = 0; i < 3; ++i) {
+    size_t& insertTime = insertTimes[triangle[i]];
+    if (time - insertTime >= VERTEX_CACHE_SIZE) {
+      insertTime = time++;
+      ++nMisses;
+    }
+  }
+  return nMisses;
+}
+
+
+void MeshProcessor::parallelFor_(size_t n, const std::function<void(size_t, size_t)>& func) {
+  size_t nThreads = std::min(static_cast<size_t>(std::max(1u, std::thread::hardware_concurrency())),
+      n / MIN_ITEMS_PER_THREAD);
+  nThreads = std::max(nThreads, static_cast<size_t>(1));
+
+  // process first range in the calling thread
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < nThreads; ++i) {
+    const size_t begin = n * i / nThreads;
+    const size_t end = n * (i + 1) / nThreads;
+    try {
+      threads.push_back(std::thread(std::cref(func), begin, end));
+    }
+    catch (const std::system_error&) {
+      // no more threads available
+      func(begin, end);
+    }
+  }
+  func(0, n / nThreads);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+
+} /* namespace scg */
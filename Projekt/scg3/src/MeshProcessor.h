@@ -0,0 +1,355 @@
+/**
+ * \file MeshProcessor.h
+ * \brief Processing passes on triangle mesh data before upload, e.g., normal and tangent generation.
+ *
+ * \author Projektgruppe "Zahnradapparatus"
+ */
+
+/*
+ * Copyright 2026 Projektgruppe "Zahnradapparatus"
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MESHPROCESSOR_H_
+#define MESHPROCESSOR_H_
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+#include "scg_glew.h"
+#include "scg_glm.h"
+
+namespace scg {
+
+
+/**
+ * Vertex attribute arrays of a triangle mesh, ready to be uploaded,
+ * and element indices (empty for DrawMode::ARRAYS, i.e., three consecutive
+ * vertices per triangle).
+ *
+ * Optional attribute arrays (texCoords, tangents, binormals) are either empty
+ * or contain one element per vertex.
+ *
+ * Optional draw ranges partition the corners (i.e., indices or vertices for
+ * DrawMode::ARRAYS) into contiguous ranges with the same material, referring
+ * to the materials defined in the material libraries (empty name for no material).
+ *
+ * Optional levels of detail (LOD) refer to contiguous ranges of the indices, starting
+ * with the original triangles (level 0). Each level is partitioned into the draw ranges
+ * in the same order, with the given number of indices per draw range.
+ */
+struct MeshData {
+  struct DrawRange {
+    GLuint first;
+    GLuint count;
+    std::string material;
+  };
+  struct LODLevel {
+    GLuint first;
+    GLuint count;
+    GLfloat error;                    // geometric error in model coordinates
+    std::vector<GLuint> rangeCounts;  // empty if there are no draw ranges
+  };
+  size_t getNVertices() const {
+    return vertices.size() / 3;
+  }
+  size_t getNCorners() const {
+    return indices.empty() ? getNVertices() : indices.size();
+  }
+  std::vector<GLfloat> vertices;
+  std::vector<GLfloat> normals;
+  std::vector<GLfloat> tangents;
+  std::vector<GLfloat> binormals;
+  std::vector<GLfloat> texCoords;
+  std::vector<GLuint> indices;
+  std::vector<DrawRange> drawRanges;
+  std::vector<LODLevel> lodLevels;
+  std::vector<std::string> materialLibraries;
+};
+
+
+/**
+ * Efficiency of the post-transform vertex cache for a sequence of triangles,
+ * simulated as FIFO cache of size MeshProcessor::VERTEX_CACHE_SIZE.
+ */
+struct VertexCacheStatistics {
+  GLfloat acmr;  // average cache miss ratio: transformed vertices per triangle (0.5 to 3)
+  GLfloat atvr;  // average transform to vertex ratio: transformed vertices per referenced vertex (>= 1)
+};
+
+
+/**
+ * \brief Processing passes on triangle mesh data before upload, e.g., normal and tangent generation.
+ *
+ * The per-triangle computations are performed on blocks of triangles stored as
+ * structure of arrays, such that the compiler can vectorize them.
+ * Large meshes are split into ranges that are processed by several threads.
+ */
+class MeshProcessor {
+
+public:
+
+  /**
+   * Replace the normals by smooth normals, computed as average of the normals of
+   * the adjacent triangles, weighted by the angles of the triangles at the vertex.
+   * Triangles are adjacent if they share a vertex position; triangles whose normals
+   * differ by more than the crease angle are not averaged, i.e., keep a sharp edge.
+   *
+   * For indexed meshes, vertices with equal position, texture coordinates, and normal
+   * are merged; tangents and binormals are removed and have to be recomputed.
+   *
+   * \param mesh mesh to be modified
+   * \param creaseAngleDeg maximum angle between averaged triangle normals (degrees),
+   *   0 for flat shading, 180 for completely smooth shading
+   */
+  static void computeSmoothNormals(MeshData& mesh, GLfloat creaseAngleDeg);
+
+  /**
+   * Compute per-vertex tangents and binormals from normals and texture coordinates,
+   * similar to MikkTSpace: the tangent frames of the adjacent triangles are weighted
+   * by their angles at the vertex and orthogonalized with respect to the vertex normal.
+   * Indexed vertices shared by triangles with mirrored texture coordinates are split,
+   * such that the binormal has a consistent orientation.
+   *
+   * Without texture coordinates, an arbitrary tangent orthogonal to the normal is used.
+   *
+   * \param mesh mesh to be modified, must contain normals
+   */
+  static void computeTangents(MeshData& mesh);
+
+  /**
+   * Build a chain of levels of detail by quadric error edge collapse (cf. MeshSimplifier).
+   * The simplified triangles refer to the original vertices and are appended to the indices,
+   * such that all levels share the vertex buffer. Level 0 contains the original triangles,
+   * further levels are added as long as the number of triangles decreases.
+   *
+   * Only indexed meshes are simplified; no levels are created for DrawMode::ARRAYS.
+   *
+   * \param mesh mesh to be modified
+   * \param ratios target ratios of the number of triangles of the original mesh,
+   *   e.g., {0.5, 0.25, 0.1}, ratios >= 1 are ignored
+   */
+  static void buildLODChain(MeshData& mesh, const std::vector<GLfloat>& ratios);
+
+  /**
+   * Reorder the triangles of an indexed mesh for the post-transform vertex cache
+   * and for overdraw (cf. optimizeVertexCache() and optimizeOverdraw()) and the vertices
+   * for fetch locality (cf. optimizeVertexFetch()).
+   * Triangles are only reordered within each draw range of each level of detail.
+   *
+   * \param mesh mesh to be modified, nothing is done for DrawMode::ARRAYS
+   */
+  static void optimizeMesh(MeshData& mesh);
+
+  /**
+   * Reorder triangles for the post-transform vertex cache (Tipsify, Sander et al. 2007):
+   * triangles are emitted as fans around vertices that are still in the cache,
+   * the next fanning vertex is chosen among the vertices of the last fan.
+   * The given order is kept if its cache miss ratio is lower.
+   *
+   * \param indices element indices, three per triangle
+   * \param nIndices number of element indices
+   * \param nVertices number of vertices referenced by the indices
+   */
+  static void optimizeVertexCache(GLuint* indices, size_t nIndices, size_t nVertices);
+
+  /**
+   * Reorder triangles for reduced overdraw, preserving most of the vertex cache efficiency
+   * (Sander et al. 2007): the triangles are split into clusters as soon as the cache miss
+   * ratio of the current cluster, starting with an empty cache, is within the threshold
+   * of the miss ratio of all triangles. Clusters facing outwards are drawn first,
+   * i.e., the clusters are sorted by descending dot product of the cluster normal and
+   * the offset of the cluster centroid from the mesh centroid.
+   *
+   * \param indices element indices, three per triangle, should be optimized
+   *   by optimizeVertexCache() before
+   * \param nIndices number of element indices
+   * \param vertices vertex positions (three components per vertex)
+   * \param nVertices number of vertices
+   * \param threshold maximum ratio of the cache miss ratios of a cluster and
+   *   of all triangles, e.g., 1.05
+   */
+  static void optimizeOverdraw(GLuint* indices, size_t nIndices, const GLfloat* vertices,
+      size_t nVertices, GLfloat threshold = 1.05f);
+
+  /**
+   * Renumber vertices in the order of their first use by the indices, such that vertex fetches
+   * access memory sequentially. Unreferenced vertices are moved to the end.
+   * The vertex attribute arrays have to be reordered by remapVertexAttribute().
+   *
+   * \param indices element indices, renumbered
+   * \param nIndices number of element indices
+   * \param nVertices number of vertices
+   * \param vertexOrder returns the old index of each new vertex
+   */
+  static void optimizeVertexFetch(GLuint* indices, size_t nIndices, size_t nVertices,
+      std::vector<GLuint>& vertexOrder);
+
+  /**
+   * Reorder a vertex attribute array according to optimizeVertexFetch().
+   *
+   * \param data attribute array with size * vertexOrder.size() components
+   * \param size number of components per vertex
+   * \param vertexOrder old index of each new vertex
+   */
+  static void remapVertexAttribute(GLfloat* data, size_t size, const std::vector<GLuint>& vertexOrder);
+
+  /**
+   * Simulate the post-transform vertex cache for the given triangles.
+   *
+   * \param indices element indices, three per triangle
+   * \param nIndices number of element indices
+   * \param nVertices number of vertices referenced by the indices
+   */
+  static VertexCacheStatistics analyzeVertexCache(const GLuint* indices, size_t nIndices,
+      size_t nVertices);
+
+  /**
+   * Quantize positions to unsigned normalized 16-bit integers (four components, w = 1)
+   * relative to the bounding cube of the positions, i.e., with equal precision in all directions.
+   *
+   * \param vertices positions (three components per vertex)
+   * \param nVertices number of vertices
+   * \param quantized returns four values per vertex
+   * \return dequantization matrix that maps normalized positions to the original positions
+   *   (translation and uniform scaling, cf. GeometryCore::setVertexTransform())
+   */
+  static glm::mat4 quantizePositions(const GLfloat* vertices, size_t nVertices,
+      std::vector<GLushort>& quantized);
+
+  /**
+   * Pack unit vectors (e.g., normals) into signed normalized 10-10-10-2 integers
+   * (GL_INT_2_10_10_10_REV), one value per vertex.
+   *
+   * \param directions unit vectors (three components per vertex)
+   * \param signs w component per vertex (-1 or 1, e.g., tangent handedness), may be nullptr for w = 0
+   * \param nVertices number of vertices
+   * \param packed returns one value per vertex
+   */
+  static void packDirections(const GLfloat* directions, const GLfloat* signs, size_t nVertices,
+      std::vector<GLuint>& packed);
+
+  /**
+   * Pack unit vectors into signed normalized 16-bit integers (four components per vertex),
+   * for OpenGL versions without GL_INT_2_10_10_10_REV, cf. packDirections().
+   */
+  static void packDirections(const GLfloat* directions, const GLfloat* signs, size_t nVertices,
+      std::vector<GLshort>& packed);
+
+  /**
+   * Compute handedness signs of tangent frames, such that
+   * binormal = sign * cross(normal, tangent) (up to orthogonalization).
+   *
+   * \param signs returns -1 or 1 per vertex
+   */
+  static void computeTangentSigns(const GLfloat* normals, const GLfloat* tangents,
+      const GLfloat* binormals, size_t nVertices, std::vector<GLfloat>& signs);
+
+  /**
+   * Convert attribute values to half floats (GL_HALF_FLOAT). The number of components
+   * is rounded up to an even number for 4-byte alignment, e.g., three-dimensional texture
+   * coordinates are padded with w = 1.
+   *
+   * \param data attribute values
+   * \param size number of components per vertex
+   * \param nVertices number of vertices
+   * \param packed returns getPaddedHalfFloatSize(size) values per vertex
+   */
+  static void packHalfFloats(const GLfloat* data, size_t size, size_t nVertices,
+      std::vector<GLushort>& packed);
+
+  /**
+   * Get number of components per vertex of packHalfFloats().
+   */
+  static size_t getPaddedHalfFloatSize(size_t size) {
+    return (size + 1) & ~static_cast<size_t>(1);
+  }
+
+  /**
+   * Size of the simulated post-transform vertex cache (number of vertices).
+   */
+  static const size_t VERTEX_CACHE_SIZE = 16;
+
+protected:
+
+  friend class MeshSimplifier;
+
+  /**
+   * Assign the same id to vertices with equal positions (ids are numbered
+   * in the order of first occurrence).
+   *
+   * \return number of unique positions
+   */
+  static size_t findUniquePositions_(const std::vector<GLfloat>& vertices,
+      std::vector<GLuint>& positionIds);
+
+  /**
+   * Compute normalized triangle normals (zero for degenerate triangles) and corner angles
+   * for the triangles [begin, end).
+   */
+  static void computeTriangleNormals_(const GLfloat* vertices, const GLuint* indices,
+      size_t begin, size_t end, GLfloat* triangleNormals, GLfloat* cornerAngles);
+
+  /**
+   * Compute unnormalized tangent (direction of increasing s) and binormal (direction of
+   * increasing t) for the triangles [begin, end). Triangles with degenerate texture
+   * coordinates get zero vectors.
+   */
+  static void computeTriangleTangents_(const GLfloat* vertices, const GLfloat* texCoords,
+      const GLuint* indices, size_t begin, size_t end, GLfloat* triangleTangents,
+      GLfloat* triangleBinormals);
+
+  /**
+   * Sort corners by key (e.g., vertex index) into contiguous groups (counting sort).
+   * Group i consists of the corners groupCorners[groupOffsets[i]] to
+   * groupCorners[groupOffsets[i + 1] - 1].
+   */
+  static void groupCorners_(const std::vector<GLuint>& cornerKeys, size_t nKeys,
+      std::vector<GLuint>& groupOffsets, std::vector<GLuint>& groupCorners);
+
+  /**
+   * Simulate a FIFO vertex cache for one triangle. A vertex is in the cache
+   * if it has been inserted less than VERTEX_CACHE_SIZE insertions ago.
+   *
+   * \param triangle three vertex indices
+   * \param insertTimes insertion time of each vertex, initialized to 0
+   * \param time current time, initialized to VERTEX_CACHE_SIZE,
+   *   increase by VERTEX_CACHE_SIZE to flush the cache
+   * \return number of cache misses
+   */
+  static unsigned int simulateVertexCache_(const GLuint* triangle, std::vector<size_t>& insertTimes,
+      size_t& time);
+
+  /**
+   * Call func(begin, end) for disjoint subranges of [0, n), in parallel if n is large enough.
+   */
+  static void parallelFor_(size_t n, const std::function<void(size_t, size_t)>& func);
+
+  /**
+   * Number of triangles processed as one block by the vectorized loops.
+   */
+  static const size_t BLOCK_SIZE = 256;
+
+  /**
+   * Minimum number of items per thread of parallelFor_().
+   */
+  static const size_t MIN_ITEMS_PER_THREAD = 16384;
+
+};
+
+
+} /* namespace scg */
+
+#endif /* MESHPROCESSOR_H_ */
@@ -0,0 +1,451 @@
+/**
+ * \file MeshSimplifier.cpp
+ *
+ * \author Projektgruppe "Zahnradapparatus"
+ */
+
+/*
+ * Copyright 2026 Projektgruppe "Zahnradapparatus"
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include "MeshSimplifier.h"
+
+namespace scg {
+
+
+const double MeshSimplifier::BORDER_WEIGHT = 10.;
+const double MeshSimplifier::MIN_NORMAL_COSINE = 0.2;
+const GLfloat MeshSimplifier::MIN_VERTEX_NORMAL_COSINE = 0.7f;
+const GLuint MeshSimplifier::NO_VERTEX = ~0u;
+
+
+void MeshSimplifier::Quadric::addPlane(const glm::dvec3& normal, double distance, double planeWeight) {
+  a00 += planeWeight * normal.x * normal.x;
+  a01 += planeWeight * normal.x * normal.y;
+  a02 += planeWeight * normal.x * normal.z;
+  a11 += planeWeight * normal.y * normal.y;
+  a12 += planeWeight * normal.y * normal.z;
+  a22 += planeWeight * normal.z * normal.z;
+  b0 += planeWeight * normal.x * distance;
+  b1 += planeWeight * normal.y * distance;
+  b2 += planeWeight * normal.z * distance;
+  c += planeWeight * distance * distance;
+}
+
+
+void MeshSimplifier::Quadric::add(const Quadric& other) {
+  a00 += other.a00;
+  a01 += other.a01;
+  a02 += other.a02;
+  a11 += other.a11;
+  a12 += other.a12;
+  a22 += other.a22;
+  b0 += other.b0;
+  b1 += other.b1;
+  b2 += other.b2;
+  c += other.c;
+  weight += other.weight;
+}
+
+
+double MeshSimplifier::Quadric::evaluate(const glm::dvec3& p) const {
+  return a00 * p.x * p.x + a11 * p.y * p.y + a22 * p.z * p.z
+      + 2. * (a01 * p.x * p.y + a02 * p.x * p.z + a12 * p.y * p.z)
+      + 2. * (b0 * p.x + b1 * p.y + b2 * p.z) + c;
+}
+
+
+MeshSimplifier::MeshSimplifier(const MeshData& mesh)
+    : mesh_(mesh), nRanges_(std::max<size_t>(mesh.drawRanges.size(), 1)),
+      triangles_(mesh.indices), nTriangles_(mesh.indices.size() / 3), maxError_(0.), mark_(0) {
+  triangles_.resize(3 * nTriangles_);
+  isTriangleAlive_.assign(nTriangles_, 1);
+
+  // draw range of each triangle
+  triangleRanges_.assign(nTriangles_, 0);
+  for (size_t r = 0; r < mesh.drawRanges.size(); ++r) {
+    const size_t begin = std::min<size_t>(mesh.drawRanges[r].first / 3, nTriangles_);
+    const size_t end = std::min<size_t>((mesh.drawRanges[r].first + mesh.drawRanges[r].count) / 3, nTriangles_);
+    std::fill(triangleRanges_.begin() + begin, triangleRanges_.begin() + end, static_cast<GLuint>(r));
+  }
+
+  // vertices with equal position are collapsed together
+  const size_t nPositions = MeshProcessor::findUniquePositions_(mesh.vertices, positionIds_);
+  positions_.resize(nPositions);
+  for (size_t v = 0; v < positionIds_.size(); ++v) {
+    positions_[positionIds_[v]] = glm::dvec3(mesh.vertices[3 * v], mesh.vertices[3 * v + 1],
+        mesh.vertices[3 * v + 2]);
+  }
+  positionTriangles_.resize(nPositions);
+  quadrics_.resize(nPositions);
+  versions_.assign(nPositions, 0);
+  isPositionAlive_.assign(nPositions, 1);
+  positionMarks_.assign(nPositions, 0);
+
+  // plane quadrics of the triangles, weighted by area;
+  // triangles with two equal positions are removed
+  std::vector<std::pair<uint64_t, GLuint>> edges;
+  edges.reserve(3 * nTriangles_);
+  for (GLuint t = 0; t < triangleRanges_.size(); ++t) {
+    const GLuint p[3] = {
+      positionIds_[triangles_[3 * t]],
+      positionIds_[triangles_[3 * t + 1]],
+      positionIds_[triangles_[3 * t + 2]]
+    };
+    if (p[0] == p[1] || p[1] == p[2] || p[2] == p[0]) {
+      isTriangleAlive_[t] = 0;
+      --nTriangles_;
+      continue;
+    }
+    for (int i = 0; i < 3; ++i) {
+      positionTriangles_[p[i]].push_back(t);
+      const GLuint a = std::min(p[i], p[(i + 1) % 3]);
+      const GLuint b = std::max(p[i], p[(i + 1) % 3]);
+      edges.push_back(std::make_pair((static_cast<uint64_t>(a) << 32) | b, t));
+    }
+    const glm::dvec3 normal = glm::cross(positions_[p[1]] - positions_[p[0]],
+        positions_[p[2]] - positions_[p[0]]);
+    const double length = glm::length(normal);
+    if (length > 0.) {
+      const glm::dvec3 unitNormal = normal / length;
+      const double distance = -glm::dot(unitNormal, positions_[p[0]]);
+      for (int i = 0; i < 3; ++i) {
+        quadrics_[p[i]].addPlane(unitNormal, distance, 0.5 * length);
+        quadrics_[p[i]].weight += 0.5 * length;
+      }
+    }
+  }
+
+  // border quadrics for edges with only one adjacent triangle or adjacent triangles
+  // of different draw ranges: plane through the edge, perpendicular to the triangle
+  std::sort(edges.begin(), edges.end());
+  for (size_t i = 0; i < edges.size(); ) {
+    size_t j = i + 1;
+    bool isBorder = false;
+    while (j < edges.size() && edges[j].first == edges[i].first) {
+      isBorder = isBorder || triangleRanges_[edges[j].second] != triangleRanges_[edges[i].second];
+      ++j;
+    }
+    isBorder = isBorder || j == i + 1;
+    if (isBorder) {
+      const GLuint a = static_cast<GLuint>(edges[i].first >> 32);
+      const GLuint b = static_cast<GLuint>(edges[i].first & 0xffffffffu);
+      const glm::dvec3 edge = positions_[b] - positions_[a];
+      for (size_t k = i; k < j; ++k) {
+        const GLuint t = edges[k].second;
+        const glm::dvec3 normal = glm::cross(
+            positions_[positionIds_[triangles_[3 * t + 1]]] - positions_[positionIds_[triangles_[3 * t]]],
+            positions_[positionIds_[triangles_[3 * t + 2]]] - positions_[positionIds_[triangles_[3 * t]]]);
+        const glm::dvec3 planeNormal = glm::cross(edge, normal);
+        const double length = glm::length(planeNormal);
+        if (length > 0.) {
+          const glm::dvec3 unitNormal = planeNormal / length;
+          const double distance = -glm::dot(unitNormal, positions_[a]);
+          const double planeWeight = BORDER_WEIGHT * glm::dot(edge, edge);
+          quadrics_[a].addPlane(unitNormal, distance, planeWeight);
+          quadrics_[b].addPlane(unitNormal, distance, planeWeight);
+        }
+      }
+    }
+    i = j;
+  }
+
+  // candidate collapses of all edges in both directions
+  for (size_t i = 0; i < edges.size(); ++i) {
+    if (i > 0 && edges[i].first == edges[i - 1].first) {
+      continue;
+    }
+    const GLuint a = static_cast<GLuint>(edges[i].first >> 32);
+    const GLuint b = static_cast<GLuint>(edges[i].first & 0xffffffffu);
+    Collapse collapse = { computeError_(a, b), a, b, 0, 0 };
+    heap_.push_back(collapse);
+    collapse.error = computeError_(b, a);
+    collapse.from = b;
+    collapse.to = a;
+    heap_.push_back(collapse);
+  }
+  std::make_heap(heap_.begin(), heap_.end(), std::greater<Collapse>());
+}
+
+
+size_t MeshSimplifier::simplify(size_t nTargetTriangles) {
+  while (nTriangles_ > nTargetTriangles && !heap_.empty()) {
+    std::pop_heap(heap_.begin(), heap_.end(), std::greater<Collapse>());
+    const Collapse collapse = heap_.back();
+    heap_.pop_back();
+    if (!isPositionAlive_[collapse.from] || !isPositionAlive_[collapse.to]
+        || versions_[collapse.from] != collapse.fromVersion
+        || versions_[collapse.to] != collapse.toVersion) {
+      // outdated candidate
+      continue;
+    }
+    if (collapse_(collapse.from, collapse.to)) {
+      maxError_ = std::max(maxError_, collapse.error);
+    }
+  }
+  return nTriangles_;
+}
+
+
+size_t MeshSimplifier::getNTriangles() const {
+  return nTriangles_;
+}
+
+
+GLfloat MeshSimplifier::getError() const {
+  return static_cast<GLfloat>(std::sqrt(maxError_));
+}
+
+
+void MeshSimplifier::getTriangles(std::vector<GLuint>& indices, std::vector<GLuint>& rangeCounts) const {
+  rangeCounts.assign(mesh_.drawRanges.size(), 0);
+  for (size_t r = 0; r < nRanges_; ++r) {
+    size_t begin = 0;
+    size_t end = isTriangleAlive_.size();
+    if (!mesh_.drawRanges.empty()) {
+      begin = std::min<size_t>(mesh_.drawRanges[r].first / 3, end);
+      end = std::min<size_t>((mesh_.drawRanges[r].first + mesh_.drawRanges[r].count) / 3, end);
+    }
+    const size_t nIndices = indices.size();
+    for (size_t t = begin; t < end; ++t) {
+      if (isTriangleAlive_[t]) {
+        indices.insert(indices.end(), &triangles_[3 * t], &triangles_[3 * t] + 3);
+      }
+    }
+    if (!mesh_.drawRanges.empty()) {
+      rangeCounts[r] = static_cast<GLuint>(indices.size() - nIndices);
+    }
+  }
+}
+
+
+double MeshSimplifier::computeError_(GLuint from, GLuint to) const {
+  Quadric quadric = quadrics_[from];
+  quadric.add(quadrics_[to]);
+  double error = quadric.evaluate(positions_[to]);
+  if (quadric.weight > 0.) {
+    error /= quadric.weight;
+  }
+  return std::max(error, 0.);
+}
+
+
+void MeshSimplifier::addCollapses_(GLuint position) {
+  std::vector<GLuint>& neighbors = neighbors_;
+  neighbors.clear();
+  for (auto t : positionTriangles_[position]) {
+    for (int i = 0; i < 3; ++i) {
+      const GLuint p = positionIds_[triangles_[3 * t + i]];
+      if (p != position) {
+        neighbors.push_back(p);
+      }
+    }
+  }
+  std::sort(neighbors.begin(), neighbors.end());
+  neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+  for (auto neighbor : neighbors) {
+    Collapse collapse = { computeError_(position, neighbor), position, neighbor,
+        versions_[position], versions_[neighbor] };
+    heap_.push_back(collapse);
+    std::push_heap(heap_.begin(), heap_.end(), std::greater<Collapse>());
+    collapse.error = computeError_(neighbor, position);
+    collapse.from = neighbor;
+    collapse.to = position;
+    std::swap(collapse.fromVersion, collapse.toVersion);
+    heap_.push_back(collapse);
+    std::push_heap(heap_.begin(), heap_.end(), std::greater<Collapse>());
+  }
+}
+
+
+bool MeshSimplifier::collapse_(GLuint from, GLuint to) {
+  compactTriangleList_(from);
+  compactTriangleList_(to);
+  const std::vector<GLuint>& fromTriangles = positionTriangles_[from];
+
+  // map each vertex at the source position to the unique vertex at the target position
+  // it shares a triangle with (i.e., collapse along attribute seams)
+  std::vector<std::pair<GLuint, GLuint>>& vertexMap = vertexMap_;
+  std::vector<GLuint>& edgeOpposites = edgeOpposites_;
+  vertexMap.clear();
+  edgeOpposites.clear();
+  for (auto t : fromTriangles) {
+    GLuint fromVertex = 0, toVertex = 0, opposite = 0;
+    bool hasTo = false;
+    for (int i = 0; i < 3; ++i) {
+      const GLuint vertex = triangles_[3 * t + i];
+      const GLuint p = positionIds_[vertex];
+      if (p == from) {
+        fromVertex = vertex;
+      }
+      else if (p == to) {
+        toVertex = vertex;
+        hasTo = true;
+      }
+      else {
+        opposite = p;
+      }
+    }
+    if (!hasTo) {
+      continue;
+    }
+    edgeOpposites.push_back(opposite);
+    auto it = std::find_if(vertexMap.begin(), vertexMap.end(),
+        [fromVertex](const std::pair<GLuint, GLuint>& entry) { return entry.first == fromVertex; });
+    if (it == vertexMap.end()) {
+      vertexMap.push_back(std::make_pair(fromVertex, toVertex));
+    }
+    else if (it->second != toVertex) {
+      // attribute seam ends at source position
+      return false;
+    }
+  }
+  if (edgeOpposites.empty()) {
+    return false;
+  }
+
+  // link condition: common neighbors must be opposite to the edge (prevents non-manifold edges)
+  // (neighbors of the source position are marked with mark_, counted common neighbors with mark_ + 1)
+  mark_ += 2;
+  for (auto t : fromTriangles) {
+    for (int i = 0; i < 3; ++i) {
+      positionMarks_[positionIds_[triangles_[3 * t + i]]] = mark_;
+    }
+  }
+  positionMarks_[from] = positionMarks_[to] = 0;
+  size_t nCommonNeighbors = 0;
+  for (auto t : positionTriangles_[to]) {
+    for (int i = 0; i < 3; ++i) {
+      GLuint& positionMark = positionMarks_[positionIds_[triangles_[3 * t + i]]];
+      if (positionMark == mark_) {
+        positionMark = mark_ + 1;
+        ++nCommonNeighbors;
+      }
+    }
+  }
+  std::sort(edgeOpposites.begin(), edgeOpposites.end());
+  edgeOpposites.erase(std::unique(edgeOpposites.begin(), edgeOpposites.end()), edgeOpposites.end());
+  if (nCommonNeighbors != edgeOpposites.size()) {
+    return false;
+  }
+
+  // vertices that do not share a triangle with the target position are mapped to the most
+  // similar vertex there (e.g., for flat shading); remaining triangles must not flip
+  for (auto t : fromTriangles) {
+    glm::dvec3 oldPositions[3], newPositions[3];
+    GLuint fromVertex = 0;
+    bool hasTo = false;
+    for (int i = 0; i < 3; ++i) {
+      const GLuint vertex = triangles_[3 * t + i];
+      const GLuint p = positionIds_[vertex];
+      oldPositions[i] = positions_[p];
+      newPositions[i] = positions_[p];
+      if (p == from) {
+        fromVertex = vertex;
+        newPositions[i] = positions_[to];
+      }
+      hasTo = hasTo || p == to;
+    }
+    if (hasTo) {
+      continue;
+    }
+    auto it = std::find_if(vertexMap.begin(), vertexMap.end(),
+        [fromVertex](const std::pair<GLuint, GLuint>& entry) { return entry.first == fromVertex; });
+    if (it == vertexMap.end()) {
+      const GLuint toVertex = findSimilarVertex_(fromVertex, to);
+      if (toVertex == NO_VERTEX) {
+        return false;
+      }
+      vertexMap.push_back(std::make_pair(fromVertex, toVertex));
+    }
+    const glm::dvec3 oldNormal = glm::cross(oldPositions[1] - oldPositions[0], oldPositions[2] - oldPositions[0]);
+    const glm::dvec3 newNormal = glm::cross(newPositions[1] - newPositions[0], newPositions[2] - newPositions[0]);
+    const double oldLength = glm::length(oldNormal);
+    const double newLength = glm::length(newNormal);
+    if (oldLength > 0. && (newLength == 0.
+        || glm::dot(oldNormal, newNormal) < MIN_NORMAL_COSINE * oldLength * newLength)) {
+      return false;
+    }
+  }
+
+  // perform collapse: remove triangles adjacent to the edge, move the others to the target position
+  std::vector<GLuint>& toTriangles = positionTriangles_[to];
+  for (auto t : fromTriangles) {
+    GLuint* triangle = &triangles_[3 * t];
+    if (positionIds_[triangle[0]] == to || positionIds_[triangle[1]] == to || positionIds_[triangle[2]] == to) {
+      isTriangleAlive_[t] = 0;
+      --nTriangles_;
+      continue;
+    }
+    for (int i = 0; i < 3; ++i) {
+      if (positionIds_[triangle[i]] == from) {
+        const GLuint fromVertex = triangle[i];
+        triangle[i] = std::find_if(vertexMap.begin(), vertexMap.end(),
+            [fromVertex](const std::pair<GLuint, GLuint>& entry) { return entry.first == fromVertex; })->second;
+      }
+    }
+    toTriangles.push_back(t);
+  }
+  quadrics_[to].add(quadrics_[from]);
+  isPositionAlive_[from] = 0;
+  std::vector<GLuint>().swap(positionTriangles_[from]);
+  ++versions_[from];
+  ++versions_[to];
+  compactTriangleList_(to);
+  addCollapses_(to);
+  return true;
+}
+
+
+GLuint MeshSimplifier::findSimilarVertex_(GLuint vertex, GLuint position) const {
+  const bool hasNormals = !mesh_.normals.empty();
+  const bool hasTexCoords = !mesh_.texCoords.empty();
+  const glm::vec3 normal = hasNormals ? glm::make_vec3(&mesh_.normals[3 * vertex]) : glm::vec3(0.f);
+  GLuint result = NO_VERTEX;
+  GLfloat maxCosine = MIN_VERTEX_NORMAL_COSINE;
+  for (auto t : positionTriangles_[position]) {
+    for (int i = 0; i < 3; ++i) {
+      const GLuint other = triangles_[3 * t + i];
+      if (positionIds_[other] != position) {
+        continue;
+      }
+      if (hasTexCoords && (mesh_.texCoords[2 * vertex] != mesh_.texCoords[2 * other]
+          || mesh_.texCoords[2 * vertex + 1] != mesh_.texCoords[2 * other + 1])) {
+        continue;
+      }
+      const GLfloat cosine = hasNormals ? glm::dot(normal, glm::make_vec3(&mesh_.normals[3 * other])) : 1.f;
+      if (cosine >= maxCosine) {
+        maxCosine = cosine;
+        result = other;
+      }
+    }
+  }
+  return result;
+}
+
+
+void MeshSimplifier::compactTriangleList_(GLuint position) {
+  std::vector<GLuint>& triangles = positionTriangles_[position];
+  triangles.erase(std::remove_if(triangles.begin(), triangles.end(),
+      [this](GLuint t) { return !isTriangleAlive_[t]; }), triangles.end());
+}
+
+
+} /* namespace scg */
@@ -0,0 +1,209 @@
+/**
+ * \file MeshSimplifier.h
+ * \brief Simplification of indexed triangle meshes by quadric error edge collapse.
+ *
+ * \author Projektgruppe "Zahnradapparatus"
+ */
+
+/*
+ * Copyright 2026 Projektgruppe "Zahnradapparatus"
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MESHSIMPLIFIER_H_
+#define MESHSIMPLIFIER_H_
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include "scg_glew.h"
+#include "scg_glm.h"
+#include "MeshProcessor.h"
+
+namespace scg {
+
+
+/**
+ * \brief Simplification of indexed triangle meshes by quadric error edge collapse,
+ *    used by MeshProcessor::buildLODChain().
+ *
+ * Edges are collapsed in the order of increasing quadric error (Garland and Heckbert),
+ * where the quadric of a vertex position is the area-weighted sum of the squared distances
+ * to the planes of its original triangles. A vertex is always collapsed onto the other end
+ * of the edge, such that the simplified triangles refer to the original vertices and
+ * all levels of detail can share one vertex buffer.
+ *
+ * Vertices with equal position but different attributes (e.g., at sharp edges or texture seams)
+ * are collapsed together. A vertex that shares a triangle with the target position is mapped
+ * to the vertex used there, such that seams are preserved; other vertices are mapped to the vertex
+ * at the target position with equal texture coordinates and the most similar normal. If no such
+ * vertex exists, the collapse is rejected. Mesh borders and borders between draw ranges are preserved
+ * by additional quadrics, collapses that would flip triangles or create non-manifold edges are rejected.
+ *
+ * The simplification is incremental, i.e., simplify() may be called with decreasing
+ * numbers of triangles to create a sequence of levels of detail.
+ */
+class MeshSimplifier {
+
+public:
+
+  /**
+   * Constructor.
+   *
+   * \param mesh indexed triangle mesh (DrawMode::ELEMENTS) to be simplified,
+   *   must be valid during the lifetime of the simplifier
+   */
+  explicit MeshSimplifier(const MeshData& mesh);
+
+  /**
+   * Collapse edges until at most the given number of triangles is left
+   * or no valid collapse is possible.
+   *
+   * \return number of remaining triangles
+   */
+  size_t simplify(size_t nTargetTriangles);
+
+  /**
+   * Get number of remaining triangles.
+   */
+  size_t getNTriangles() const;
+
+  /**
+   * Get maximum geometric error of the collapses performed so far, i.e., approximate
+   * distance between the original and the simplified surface (in model coordinates).
+   */
+  GLfloat getError() const;
+
+  /**
+   * Append the element indices of the remaining triangles to the given index array,
+   * sorted by draw range (keeping the original order within each range).
+   *
+   * \param indices index array the triangles are appended to
+   * \param rangeCounts returns number of indices per draw range (empty if the mesh has no draw ranges)
+   */
+  void getTriangles(std::vector<GLuint>& indices, std::vector<GLuint>& rangeCounts) const;
+
+protected:
+
+  /**
+   * Symmetric 4x4 quadric Q(p) = p^T A p + 2 b^T p + c, accumulated with a weight (area)
+   * to normalize the error.
+   */
+  struct Quadric {
+    Quadric()
+        : a00(0.), a01(0.), a02(0.), a11(0.), a12(0.), a22(0.),
+          b0(0.), b1(0.), b2(0.), c(0.), weight(0.) {
+    }
+    void addPlane(const glm::dvec3& normal, double distance, double planeWeight);
+    void add(const Quadric& other);
+    double evaluate(const glm::dvec3& p) const;
+    double a00, a01, a02, a11, a12, a22;
+    double b0, b1, b2;
+    double c;
+    double weight;
+  };
+
+  /**
+   * Candidate collapse of a vertex position onto another one, valid as long as the
+   * versions of both positions are unchanged.
+   */
+  struct Collapse {
+    double error;
+    GLuint from;
+    GLuint to;
+    GLuint fromVersion;
+    GLuint toVersion;
+    bool operator>(const Collapse& other) const {
+      return error > other.error;
+    }
+  };
+
+  /**
+   * Compute normalized squared error of collapsing position from onto position to.
+   */
+  double computeError_(GLuint from, GLuint to) const;
+
+  /**
+   * Add candidate collapses of all edges adjacent to the given position.
+   */
+  void addCollapses_(GLuint position);
+
+  /**
+   * Check collapse and perform it if valid.
+   *
+   * \return true if the collapse has been performed
+   */
+  bool collapse_(GLuint from, GLuint to);
+
+  /**
+   * Find the vertex at the given position with equal texture coordinates and the most similar
+   * normal (within MIN_VERTEX_NORMAL_COSINE).
+   *
+   * \return vertex index or NO_VERTEX if no such vertex exists
+   */
+  GLuint findSimilarVertex_(GLuint vertex, GLuint position) const;
+
+  /**
+   * Remove deleted triangles from the triangle list of a position.
+   */
+  void compactTriangleList_(GLuint position);
+
+  /**
+   * Weight of border quadrics relative to triangle quadrics.
+   */
+  static const double BORDER_WEIGHT;
+
+  /**
+   * Minimum cosine of the angle between triangle normals before and after a collapse.
+   */
+  static const double MIN_NORMAL_COSINE;
+
+  /**
+   * Minimum cosine of the angle between the normals of a vertex and the vertex it is mapped to.
+   */
+  static const GLfloat MIN_VERTEX_NORMAL_COSINE;
+
+  /**
+   * Invalid vertex index.
+   */
+  static const GLuint NO_VERTEX;
+
+  const MeshData& mesh_;
+  size_t nRanges_;
+  std::vector<GLuint> triangles_;                       // three vertex indices per triangle
+  std::vector<GLuint> triangleRanges_;                  // draw range of each triangle
+  std::vector<char> isTriangleAlive_;
+  size_t nTriangles_;
+  std::vector<GLuint> positionIds_;                     // position of each vertex
+  std::vector<glm::dvec3> positions_;
+  std::vector<std::vector<GLuint>> positionTriangles_;  // triangles adjacent to each position
+  std::vector<Quadric> quadrics_;
+  std::vector<GLuint> versions_;
+  std::vector<char> isPositionAlive_;
+  std::vector<Collapse> heap_;                          // min-heap of candidate collapses
+  double maxError_;
+
+  // temporary data of collapse_() and addCollapses_()
+  std::vector<GLuint> positionMarks_;
+  GLuint mark_;
+  std::vector<std::pair<GLuint, GLuint>> vertexMap_;
+  std::vector<GLuint> edgeOpposites_;
+  std::vector<GLuint> neighbors_;
+
+};
+
+
+} /* namespace scg */
+
+#endif /* MESHSIMPLIFIER_H_ */
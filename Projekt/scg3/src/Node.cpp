@@ -21,20 +21,35 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <cassert>
 #include "Composite.h"
 #include "Core.h"
 #include "Node.h"
+#include "Transformation.h"
 
 namespace scg {
 
 
+unsigned int Node::currentBoundingBoxGeneration_ = 0;
+unsigned int Node::currentStructureGeneration_ = 0;
+const glm::mat4 Node::IDENTITY_MATRIX(1.0f);
+
+
 Node::Node()
-  : parent_(nullptr), isVisible_(true) {
+  : parent_(nullptr), isVisible_(true), hasMetaInfo_(false), isShared_(false),
+    isBoundingBoxValid_(false), boundingBoxGeneration_(0), structureGeneration_(0),
+    isStructureCompiled_(false) {
 }
 
 
 Node::~Node() {
+  if (hasMetaInfo_) {
+    getMetaInfoTable_().erase(this);
+  }
+  if (isShared_) {
+    getSharedParentTable_().erase(this);
+  }
 }
 
 
@@ -43,18 +58,14 @@ void Node::clear() {
 
 
 void Node::destroy() {
-  // remove node from tree
-  if(parent_) {
+  // remove node from all parents, the next parent takes the place of the removed one
+  while (parent_) {
     bool isNodeRemoved = false;
     parent_->removeChild(this, isNodeRemoved);
     assert(isNodeRemoved);
     isNodeRemoved = !isNodeRemoved;   // avoid warning (unused variable) in release build
   }
 
-  // clear (smart) pointers
-  rightSibling_.reset();
-  parent_ = nullptr;
-
   // clear node data (if any)
   clear();
 }
@@ -66,12 +77,19 @@ int Node::getNCores() const {
 
 
 const std::string& Node::getMetaInfo(const std::string& key) const {
-  return metaInfo_[key];
+  static const std::string EMPTY_VALUE;
+  if (!hasMetaInfo_) {
+    return EMPTY_VALUE;
+  }
+  const auto& metaInfo = getMetaInfoTable_()[this];
+  auto it = metaInfo.find(key);
+  return it != metaInfo.end() ? it->second : EMPTY_VALUE;
 }
 
 
 void Node::setMetaInfo(const std::string& key, const std::string& value) {
-  metaInfo_[key] = value;
+  getMetaInfoTable_()[this][key] = value;
+  hasMetaInfo_ = true;
 }
 
 
@@ -81,7 +99,83 @@ bool Node::isVisible() const{
 
 
 void Node::setVisible(bool isVisible) {
-  isVisible_ = isVisible;
+  if (isVisible != isVisible_) {
+    isVisible_ = isVisible;
+
+    // a hidden node is not compiled, hence propagate the change to the ancestors anyway
+    isStructureCompiled_ = true;
+    incrementStructureGeneration_();
+  }
+}
+
+
+int Node::getNParents() const {
+  if (!parent_) {
+    return 0;
+  }
+  return isShared_ ? 1 + static_cast<int>(getSharedParentTable_()[this].size()) : 1;
+}
+
+
+bool Node::isShared() const {
+  return isShared_;
+}
+
+
+const BoundingBox& Node::getBoundingBox() {
+  if (!isBoundingBoxValid_ || boundingBoxGeneration_ != currentBoundingBoxGeneration_) {
+    boundingBox_ = computeBoundingBox_();
+    isBoundingBoxValid_ = true;
+    boundingBoxGeneration_ = currentBoundingBoxGeneration_;
+  }
+  return boundingBox_;
+}
+
+
+void Node::invalidateBoundingBox() {
+  // ancestors of an invalid node are invalid as well;
+  // follow first parents directly, further parents of shared nodes via a stack
+  std::vector<Node*> stack;
+  Node* node = this;
+  while (node) {
+    if (node->isBoundingBoxValid_) {
+      node->isBoundingBoxValid_ = false;
+      if (node->isShared_) {
+        for (Composite* parent : getSharedParentTable_()[node]) {
+          stack.push_back(parent);
+        }
+      }
+      node = node->parent_;
+    }
+    else {
+      node = nullptr;
+    }
+    if (!node && !stack.empty()) {
+      node = stack.back();
+      stack.pop_back();
+    }
+  }
+}
+
+
+void Node::invalidateAllBoundingBoxes() {
+  ++currentBoundingBoxGeneration_;
+}
+
+
+const glm::mat4& Node::getWorldMatrix() {
+  Transformation* parentTransformation = getParentTransformation_();
+  return parentTransformation ? parentTransformation->getWorldMatrix() : IDENTITY_MATRIX;
+}
+
+
+void Node::invalidateWorldMatrix() {
+  // do nothing by default
+}
+
+
+unsigned int Node::getStructureGeneration() const {
+  return structureGeneration_;
 }
 
 
@@ -95,33 +189,95 @@ void Node::render(RenderState* renderState) {
 }
 
 
-void Node::addSibling_(NodeSP sibling) {
-  assert(sibling);
-  if (!rightSibling_) {
-    // no right sibling yet, add new sibling
-    rightSibling_ = sibling;
-    sibling->parent_ = parent_;
+Composite* Node::asComposite_() {
+  return nullptr;
+}
+
+
+Transformation* Node::asTransformation_() {
+  return nullptr;
+}
+
+
+Transformation* Node::getParentTransformation_(bool* isPathShared) const {
+  bool isShared = isShared_;
+  for (Node* node = parent_; node; node = node->parent_) {
+    Transformation* transformation = node->asTransformation_();
+    if (transformation) {
+      if (isPathShared) {
+        *isPathShared = isShared;
+      }
+      return transformation;
+    }
+    isShared = isShared || node->isShared_;
+  }
+  if (isPathShared) {
+    *isPathShared = isShared;
+  }
+  return nullptr;
+}
+
+
+void Node::addParent_(Composite* parent) {
+  assert(parent);
+  if (!parent_) {
+    parent_ = parent;
+    return;
+  }
+  getSharedParentTable_()[this].push_back(parent);
+  isShared_ = true;
+}
+
+
+void Node::removeParent_(Composite* parent) {
+  if (!isShared_) {
+    assert(parent_ == parent);
+    parent_ = nullptr;
+    return;
+  }
+  auto it = getSharedParentTable_().find(this);
+  assert(it != getSharedParentTable_().end());
+  std::vector<Composite*>& parents = it->second;
+  if (parent_ == parent) {
+    parent_ = parents.front();
+    parents.erase(parents.begin());
   }
   else {
-    // add new sibling to right sibling (recursively)
-    rightSibling_->addSibling_(sibling);
+    auto parentIt = std::find(parents.begin(), parents.end(), parent);
+    assert(parentIt != parents.end());
+    parents.erase(parentIt);
+  }
+  if (parents.empty()) {
+    getSharedParentTable_().erase(it);
+    isShared_ = false;
   }
 }
 
 
-void Node::removeSibling_(Node* node, bool& result) {
-  assert(node);
-  result = false;
-  if (rightSibling_) {
-    // check if node to remove is right sibling
-    if (node == rightSibling_.get()) {
-      // remove right sibling
-      rightSibling_ = node->rightSibling_;
-      result = true;
+void Node::incrementStructureGeneration_() {
+  // ancestors of a node that has not been compiled since its last change have a newer
+  // generation than the compiled one already; follow first parents directly, further
+  // parents of shared nodes via a stack (cf. invalidateBoundingBox())
+  ++currentStructureGeneration_;
+  std::vector<Node*> stack;
+  Node* node = this;
+  while (node) {
+    if (node->isStructureCompiled_) {
+      node->structureGeneration_ = currentStructureGeneration_;
+      node->isStructureCompiled_ = false;
+      if (node->isShared_) {
+        for (Composite* parent : getSharedParentTable_()[node]) {
+          stack.push_back(parent);
+        }
+      }
+      node = node->parent_;
     }
     else {
-      // search siblings of right sibling for node to remove (recursively)
-      rightSibling_->removeSibling_(node, result);
+      node = nullptr;
+    }
+    if (!node && !stack.empty()) {
+      node = stack.back();
+      stack.pop_back();
     }
   }
 }
@@ -142,4 +298,26 @@ void Node::postProcessCores_(RenderState* renderState) {
 }
 
 
+std::unordered_map<const Node*, std::unordered_map<std::string, std::string>>&
+    Node::getMetaInfoTable_() {
+  // allocated on first use, i.e., only if any node has meta-information,
+  // and never deleted, such that nodes may be destroyed during static deinitialization
+  static auto metaInfoTable = new std::unordered_map<const Node*,
+      std::unordered_map<std::string, std::string>>();
+  return *metaInfoTable;
+}
+
+
+std::unordered_map<const Node*, std::vector<Composite*>>& Node::getSharedParentTable_() {
+  // allocated on first use and never deleted (cf. getMetaInfoTable_())
+  static auto sharedParentTable = new std::unordered_map<const Node*, std::vector<Composite*>>();
+  return *sharedParentTable;
+}
+
+
+BoundingBox Node::computeBoundingBox_() {
+  return BoundingBox::createInfinite();
+}
+
+
 } /* namespace scg */
@@ -28,6 +28,7 @@
 #include <string>
 #include <unordered_map>
 #include <vector>
+#include "BoundingBox.h"
 #include "scg_internals.h"
 
 namespace scg {
@@ -36,10 +37,18 @@ namespace scg {
 /**
  * \brief Base class for all nodes (composite pattern, abstract).
  *
- * The node tree of the scene graph is organized as a left-child right-sibling tree.
- * While all nodes may have siblings and a parent, only composite nodes may have
- * children (cf. Composite).
+ * While all nodes may have a parent, only composite nodes may have children,
+ * which they store in a contiguous vector (cf. Composite).
+ * The node tree is traversed iteratively, such that neither the number of siblings
+ * nor the depth of the tree is limited by the call stack.
  * Certain nodes may possess one or several cores (cf. Core).
+ * Meta-information is stored in a side table, which is allocated for nodes
+ * that have meta-information only.
+ *
+ * A node may be a child of several composite nodes (shared sub-tree), such that
+ * repeated parts of a scene are stored only once and rendered once per path from
+ * the root (cf. Composite::addChild()). The first parent is stored in the node,
+ * further parents in a side table like the meta-information.
  *
  * Note: When the node is rendered, its cores are procesed in the order they
  * have been added to the node.
@@ -47,6 +56,7 @@ namespace scg {
 class Node {
 
   friend class Composite;
+  friend class SceneCompiler;
 
 public:
 
@@ -79,6 +89,7 @@ public:
    * Get meta-information value for a given key.
    * \param key key to search for
    * \return value for the key or an empty string if there is no such key
+   *   (valid until meta-information of any node is changed)
    */
   const std::string& getMetaInfo(const std::string& key) const;
 
@@ -99,6 +110,59 @@ public:
    */
   void setVisible(bool isVisible = true);
 
+  /**
+   * Get number of composite nodes this node is a child of.
+   */
+  int getNParents() const;
+
+  /**
+   * Check if node is shared, i.e., a child of more than one composite node.
+   */
+  bool isShared() const;
+
+  /**
+   * Get axis-aligned bounding box of node and sub-tree in the coordinate system of the
+   * parent node, i.e., including the transformation of this node (if any).
+   * The box is cached until it is invalidated (cf. invalidateBoundingBox()).
+   */
+  const BoundingBox& getBoundingBox();
+
+  /**
+   * Mark cached bounding boxes of this node and its ancestors (via all parents) as outdated.
+   * Called automatically when transformations, children, cores, or instances change.
+   */
+  void invalidateBoundingBox();
+
+  /**
+   * Mark cached bounding boxes of all nodes as outdated.
+   * Called automatically when the bounds of a geometry core change.
+   */
+  static void invalidateAllBoundingBoxes();
+
+  /**
+   * Get world matrix, i.e., the transformation from the coordinate system of this node
+   * into the coordinate system of the root node. Default: cached world matrix of the
+   * nearest ancestor transformation (cf. Transformation::getWorldMatrix()) or identity.
+   * Ancestors are determined by the first parent of each node, i.e., for shared nodes
+   * the world matrix refers to one of several paths from the root.
+   */
+  virtual const glm::mat4& getWorldMatrix();
+
+  /**
+   * Mark cached world matrices of the transformations in this node's sub-tree as outdated.
+   * Called automatically when transformations change or the node is added to or removed
+   * from a composite node. Default: do nothing, since leaf nodes have no sub-tree.
+   */
+  virtual void invalidateWorldMatrix();
+
+  /**
+   * Get structure generation of this node's sub-tree, which changes whenever the structure
+   * of the sub-tree changes, i.e., when children are added or removed, nodes are shown
+   * or hidden, or cores are added to groups below this node (cf. SceneCompiler).
+   * Changes in other node trees or in hidden sub-trees do not affect it.
+   */
+  unsigned int getStructureGeneration() const;
+
   /**
    * Traverse node tree (depth-first, pre-order) with given traverser.
    */
@@ -117,18 +181,44 @@ public:
 protected:
 
   /**
-   * Add sibling to this node, i.e., child to its parent (recursively).
-   * Called by Composite::addChild().
+   * Get this node as composite node, called by Composite::traverse() and
+   * Composite::destroy() to descend into the sub-tree without recursion.
+   * \return nullptr by default, this pointer for composite nodes
+   */
+  virtual Composite* asComposite_();
+
+  /**
+   * Get this node as transformation node, called to find the nearest ancestor transformation.
+   * \return nullptr by default, this pointer for transformation nodes
+   */
+  virtual Transformation* asTransformation_();
+
+  /**
+   * Get nearest ancestor transformation via the first parents.
+   * \param isPathShared if not null, set to true if this node or any ancestor below
+   *   the transformation is shared, otherwise false
+   * \return transformation or nullptr if there is none
+   */
+  Transformation* getParentTransformation_(bool* isPathShared = nullptr) const;
+
+  /**
+   * Add parent, called by Composite::addChild().
    */
-  void addSibling_(NodeSP sibling);
+  void addParent_(Composite* parent);
 
   /**
-   * Remove sibling from this node, i.e., child from its parent (recursively).
-   * Called by Composite::removeChild().
-   * \param node pointer to node to be removed
-   * \param result true if node has been found and removed
+   * Remove parent (one occurrence), called when the node is removed from a composite node.
+   * If the first parent is removed, the next parent (if any) takes its place.
    */
-  void removeSibling_(Node* node, bool& result);
+  void removeParent_(Composite* parent);
+
+  /**
+   * Set structure generation of this node and its ancestors (via all parents) to a new
+   * value, called when the structure of this node or its sub-tree changes.
+   * Nodes whose structure has not been compiled since their last change are skipped
+   * together with their ancestors, since these are outdated already (cf. SceneCompiler).
+   */
+  void incrementStructureGeneration_();
 
   /**
    * Process node cores by calling their render() methods,
@@ -142,13 +232,37 @@ protected:
    */
   void postProcessCores_(RenderState* renderState);
 
+  /**
+   * Get side table of meta-information of all nodes that have meta-information.
+   */
+  static std::unordered_map<const Node*, std::unordered_map<std::string, std::string>>& getMetaInfoTable_();
+
+  /**
+   * Get side table of further parents (except the first one) of all shared nodes.
+   */
+  static std::unordered_map<const Node*, std::vector<Composite*>>& getSharedParentTable_();
+
+  /**
+   * Compute bounding box in the coordinate system of the parent node,
+   * called by getBoundingBox(). Default: infinite box, i.e., node is never culled.
+   */
+  virtual BoundingBox computeBoundingBox_();
+
 protected:
 
-  NodeSP rightSibling_;
   Composite* parent_;
   std::vector<CoreSP> cores_;
   bool isVisible_;
-  mutable std::unordered_map<std::string, std::string> metaInfo_;
+  bool hasMetaInfo_;
+  bool isShared_;
+  BoundingBox boundingBox_;
+  bool isBoundingBoxValid_;
+  unsigned int boundingBoxGeneration_;
+  unsigned int structureGeneration_;
+  bool isStructureCompiled_;
+  static unsigned int currentBoundingBoxGeneration_;
+  static unsigned int currentStructureGeneration_;
+  static const glm::mat4 IDENTITY_MATRIX;
 
 };
 
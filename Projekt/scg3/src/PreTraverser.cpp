@@ -43,7 +43,7 @@ PreTraverser::~PreTraverser() {
 
 void PreTraverser::visitCamera(Camera* node) {
   // apply camera transformation, but do not render coordinate axes
-  node->Transformation::render(renderState_);
+  pushWorldMatrix_(node);
 
   // save projection and view transformation
   renderState_->setProjection(node->getProjection());
@@ -52,7 +52,7 @@ void PreTraverser::visitCamera(Camera* node) {
 
 
 void PreTraverser::visitPostCamera(Camera* node) {
-  node->renderPost(renderState_);
+  renderState_->modelViewStack.popMatrix();
 }
 
 
@@ -62,12 +62,24 @@ void PreTraverser::visitLightPosition(LightPosition* node) {
 
 
 void PreTraverser::visitTransformation(Transformation* node) {
-  node->render(renderState_);
+  pushWorldMatrix_(node);
 }
 
 
 void PreTraverser::visitPostTransformation(Transformation* node) {
-  node->renderPost(renderState_);
+  renderState_->modelViewStack.popMatrix();
+}
+
+
+void PreTraverser::pushWorldMatrix_(Transformation* node) {
+  renderState_->modelViewStack.pushMatrix();
+  const glm::mat4& worldMatrix = node->getWorldMatrix();
+  if (node->isWorldMatrixUnique()) {
+    renderState_->modelViewStack.setMatrix(worldMatrix);
+  }
+  else {
+    renderState_->modelViewStack.multMatrix(node->getMatrix());
+  }
 }
 
 
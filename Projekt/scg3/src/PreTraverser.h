@@ -33,6 +33,11 @@ namespace scg {
 
 /**
  * \brief A traverser that searches Camera and LightPosition nodes in the scene graph (visitor pattern).
+ *
+ * The model-view matrix of each transformation is set to its cached world matrix
+ * (cf. Transformation::getWorldMatrix()) instead of being multiplied along the path,
+ * except in shared sub-trees, where the local matrices are accumulated per path.
+ * If a Camera or LightPosition node is reached via several paths, the last one is used.
  */
 class PreTraverser: public Traverser {
 
@@ -51,15 +56,16 @@ public:
   // leaf nodes
 
   /**
-   * Visit LightPosition node: set model tranformation of associated Light.
+   * Visit LightPosition node: set model tranformation of associated Light
+   * to current model-view matrix of RenderState.
    */
   virtual void visitLightPosition(LightPosition* node);
 
   // composite nodes
 
   /**
-   * Visit Camera node: apply camera transformation, update model-view
-   * matrix of RenderState, save projection and view tranformation.
+   * Visit Camera node: set model-view matrix of RenderState to world matrix
+   * of camera, save projection and view tranformation.
    */
   virtual void visitCamera(Camera* node);
 
@@ -70,7 +76,7 @@ public:
   virtual void visitPostCamera(Camera* node);
 
   /**
-   * Visit Transformation node: update model-view matrix of RenderState.
+   * Visit Transformation node: set model-view matrix of RenderState to world matrix.
    */
   virtual void visitTransformation(Transformation* node);
 
@@ -80,6 +86,14 @@ public:
    */
   virtual void visitPostTransformation(Transformation* node);
 
+protected:
+
+  /**
+   * Push model-view matrix and set it to the world matrix of the given transformation,
+   * or multiply it by the local matrix if the world matrix is not unique (shared sub-tree).
+   */
+  void pushWorldMatrix_(Transformation* node);
+
 };
 
 
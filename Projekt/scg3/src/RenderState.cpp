@@ -31,7 +31,7 @@ namespace scg {
 
 
 RenderState::RenderState()
-    : colorCore_(nullptr), shaderCore_(nullptr), projection_(1.0f), viewTransform_(1.0f), tempMatrix_(1.0f),
+    : colorCore_(nullptr), shaderCore_(nullptr), projection_(1.0f), viewTransform_(1.0f), viewport_(0), tempMatrix_(1.0f),
       isLightingEnabled_(true), nLights_(0), lightUBO_(0), globalAmbientLight_(0.f, 0.f, 0.f, 1.f) {
 }
 
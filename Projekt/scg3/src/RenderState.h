@@ -181,6 +181,21 @@ public:
     projection_ = projection;
   }
 
+  /**
+   * Get viewport (x, y, width, height) the scene is rendered to.
+   */
+  const glm::ivec4& getViewport() const {
+    return viewport_;
+  }
+
+  /**
+   * Set viewport (x, y, width, height) the scene is rendered to,
+   * to be called by Renderer when the window size changes.
+   */
+  void setViewport(const glm::ivec4& viewport) {
+    viewport_ = viewport;
+  }
+
   /**
    * Get current model-view-projection matrix.
    */
@@ -251,6 +266,7 @@ protected:
   ShaderCore* shaderCore_;
   glm::mat4 projection_;
   glm::mat4 viewTransform_;
+  glm::ivec4 viewport_;
   mutable glm::mat4 tempMatrix_;
   bool isLightingEnabled_;
   GLint nLights_;
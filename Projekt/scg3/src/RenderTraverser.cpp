@@ -22,7 +22,9 @@
  */
 
 #include "Camera.h"
+#include "DrawBatcher.h"
 #include "Group.h"
+#include "InstancedShape.h"
 #include "Light.h"
 #include "RenderState.h"
 #include "RenderTraverser.h"
@@ -41,43 +43,87 @@ RenderTraverser::~RenderTraverser() {
 }
 
 
+void RenderTraverser::setBatchingEnabled(bool isEnabled) {
+  if (isEnabled && !drawBatcher_) {
+    drawBatcher_.reset(new DrawBatcher());
+  }
+  else if (!isEnabled && drawBatcher_) {
+    drawBatcher_->flush(renderState_);
+    drawBatcher_.reset();
+  }
+}
+
+
+void RenderTraverser::flush() {
+  if (drawBatcher_) {
+    drawBatcher_->flush(renderState_);
+  }
+}
+
+
 void RenderTraverser::visitShape(Shape* node) {
+  if (!drawBatcher_ || !drawBatcher_->addShape(node, renderState_)) {
+    node->render(renderState_);
+  }
+}
+
+
+void RenderTraverser::visitInstancedShape(InstancedShape* node) {
   node->render(renderState_);
 }
 
 
 void RenderTraverser::visitCamera(Camera* node) {
+  flush();
   node->render(renderState_);
 }
 
 
 void RenderTraverser::visitPostCamera(Camera* node) {
+  flush();
   node->renderPost(renderState_);
 }
 
 
 void RenderTraverser::visitGroup(Group* node) {
+  // batched shapes have to be drawn with the cores of their own group
+  if (node->getNCores() > 0) {
+    flush();
+  }
   node->render(renderState_);
 }
 
 
 void RenderTraverser::visitPostGroup(Group* node) {
+  if (node->getNCores() > 0) {
+    flush();
+  }
   node->renderPost(renderState_);
 }
 
 
 void RenderTraverser::visitLight(Light* node) {
+  flush();
   node->render(renderState_);
 }
 
 
 void RenderTraverser::visitPostLight(Light* node) {
+  flush();
   node->renderPost(renderState_);
 }
 
 
 void RenderTraverser::visitTransformation(Transformation* node) {
-  node->render(renderState_);
+  // use cached world matrix, accumulate local matrices per path in shared sub-trees
+  renderState_->modelViewStack.pushMatrix();
+  const glm::mat4& worldMatrix = node->getWorldMatrix();
+  if (node->isWorldMatrixUnique()) {
+    renderState_->modelViewStack.setMatrix(renderState_->getViewTransform() * worldMatrix);
+  }
+  else {
+    renderState_->modelViewStack.multMatrix(node->getMatrix());
+  }
 }
 
 
@@ -26,6 +26,7 @@
 #define RENDERTRAVERSER_H_
 
 #include "Traverser.h"
+#include "scg_internals.h"
 
 namespace scg {
 
@@ -39,6 +40,12 @@ class RenderState;
 
 /**
  * \brief A traverser that renders the scene graph (visitor pattern).
+ *
+ * The model-view matrix of a Transformation node is computed from the view transformation
+ * of the RenderState and the cached world matrix of the node (cf. Transformation::getWorldMatrix()),
+ * i.e., the scene graph has to be traversed from its root, with the model-view matrix set
+ * to the view transformation (cf. StandardRenderer::render()). In shared sub-trees,
+ * the local matrices are multiplied along the current path instead.
  */
 class RenderTraverser: public Traverser {
 
@@ -54,6 +61,20 @@ public:
    */
   virtual ~RenderTraverser();
 
+  /**
+   * Enable or disable batching of shapes stored in geometry arenas and automatic
+   * instancing of shapes with equal geometry and cores (cf. DrawBatcher).
+   * Default: disabled.
+   */
+  void setBatchingEnabled(bool isEnabled);
+
+  /**
+   * Draw shapes that have been batched but not drawn yet.
+   * Called automatically before the render state changes, and by
+   * StandardRenderer::render() after the traversal.
+   */
+  void flush();
+
   // leaf nodes
 
   /**
@@ -61,6 +82,11 @@ public:
    */
   virtual void visitShape(Shape* node);
 
+  /**
+   * Visit InstancedShape node: render all instances (not batched).
+   */
+  virtual void visitInstancedShape(InstancedShape* node);
+
   // composite nodes
 
   /**
@@ -96,7 +122,9 @@ public:
   virtual void visitPostLight(Light* node);
 
   /**
-   * Visit Transformation node: update model-view matrix of RenderState.
+   * Visit Transformation node: set model-view matrix of RenderState to product of
+   * view transformation and world matrix, or multiply it by the local matrix
+   * if the world matrix is not unique (shared sub-tree).
    */
   virtual void visitTransformation(Transformation* node);
 
@@ -106,6 +134,10 @@ public:
    */
   virtual void visitPostTransformation(Transformation* node);
 
+protected:
+
+  DrawBatcherUP drawBatcher_;
+
 };
 
 
@@ -0,0 +1,113 @@
+/**
+ * \file SceneArena.cpp
+ *
+ * \author Projektgruppe "Zahnradapparatus"
+ */
+
+/*
+ * Copyright 2026 Projektgruppe "Zahnradapparatus"
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include "SceneArena.h"
+
+namespace scg {
+
+
+std::size_t SceneArena::nTypes_ = 0;
+
+
+SceneArena::SceneArena(std::size_t blockSize)
+    : poolSet_(new PoolSet()) {
+  poolSet_->blockSize = blockSize;
+  poolSet_->memorySize = 0;
+  poolSet_->nObjects = 0;
+  poolSet_->isArenaAlive = true;
+}
+
+
+SceneArena::~SceneArena() {
+  // release memory blocks now or with the last object
+  poolSet_->isArenaAlive = false;
+  if (poolSet_->nObjects == 0) {
+    delete poolSet_;
+  }
+}
+
+
+SceneArenaSP SceneArena::create(std::size_t blockSize) {
+  return std::make_shared<SceneArena>(blockSize);
+}
+
+
+std::size_t SceneArena::getNObjects() const {
+  return poolSet_->nObjects;
+}
+
+
+std::size_t SceneArena::getMemorySize() const {
+  return poolSet_->memorySize;
+}
+
+
+void* SceneArena::PoolSet::allocate(std::size_t typeIndex, std::size_t size,
+    std::size_t alignment) {
+  assert(alignment <= alignof(std::max_align_t));
+  if (typeIndex >= pools.size()) {
+    pools.resize(typeIndex + 1, { 0, nullptr });
+  }
+  Pool& pool = pools[typeIndex];
+  if (pool.slotSize == 0) {
+    // slots have to hold the pointer to the next free slot
+    const std::size_t slotAlignment = std::max(alignment, alignof(void*));
+    pool.slotSize = (std::max(size, sizeof(void*)) + slotAlignment - 1) / slotAlignment * slotAlignment;
+  }
+
+  // create new block and link its slots in ascending order, if there is no free slot
+  if (!pool.freeSlot) {
+    const std::size_t nSlots = std::max(blockSize / pool.slotSize, std::size_t(1));
+    blocks.emplace_back(new char[nSlots * pool.slotSize]);
+    memorySize += nSlots * pool.slotSize;
+    char* block = blocks.back().get();
+    for (std::size_t i = nSlots; i-- > 0; ) {
+      void* slot = block + i * pool.slotSize;
+      *static_cast<void**>(slot) = pool.freeSlot;
+      pool.freeSlot = slot;
+    }
+  }
+
+  void* slot = pool.freeSlot;
+  pool.freeSlot = *static_cast<void**>(slot);
+  ++nObjects;
+  return slot;
+}
+
+
+void SceneArena::PoolSet::deallocate(std::size_t typeIndex, void* slot) {
+  assert(typeIndex < pools.size());
+  assert(nObjects > 0);
+  Pool& pool = pools[typeIndex];
+  *static_cast<void**>(slot) = pool.freeSlot;
+  pool.freeSlot = slot;
+
+  // release all memory blocks with the last object of a destroyed arena
+  if (--nObjects == 0 && !isArenaAlive) {
+    delete this;
+  }
+}
+
+
+} /* namespace scg */
@@ -0,0 +1,201 @@
+/**
+ * \file SceneArena.h
+ * \brief Pool allocator for nodes and cores, which are created as shared pointers
+ *    from contiguous memory blocks.
+ *
+ * \author Projektgruppe "Zahnradapparatus"
+ */
+
+/*
+ * Copyright 2026 Projektgruppe "Zahnradapparatus"
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SCENEARENA_H_
+#define SCENEARENA_H_
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+#include "scg_internals.h"
+
+namespace scg {
+
+
+/**
+ * \brief Pool allocator for nodes and cores, which are created as shared pointers
+ *    from contiguous memory blocks.
+ *
+ * Objects are created by make(), e.g., arena->make<Transformation>(), instead of
+ * Transformation::create(). The returned shared pointers are the same as the ones
+ * returned by create(), i.e., objects of an arena may be combined with objects created
+ * otherwise. Each object and its reference counts occupy one slot of the pool of its type.
+ * Pools consist of memory blocks of fixed size, which are created on demand, such that
+ * objects of the same type created in sequence are stored contiguously.
+ *
+ * Released slots are reused by subsequently created objects of the same type. The memory
+ * blocks are released together (bulk destruction) when both the arena and all objects
+ * created by it have been destroyed, i.e., objects may outlive the arena.
+ *
+ * Note: The arena is not thread-safe, objects have to be created and released by
+ * one thread only.
+ */
+class SceneArena {
+
+protected:
+
+  /**
+   * Pool of slots of equal size and alignment.
+   */
+  struct Pool {
+    std::size_t slotSize;
+    void* freeSlot;                 // first free slot, pointing to next free slot
+  };
+
+  /**
+   * Pools and memory blocks, shared by the arena and the allocators of its objects.
+   */
+  struct PoolSet {
+    std::vector<Pool> pools;        // indexed by type index
+    std::vector<std::unique_ptr<char[]>> blocks;
+    std::size_t blockSize;
+    std::size_t memorySize;
+    std::size_t nObjects;
+    bool isArenaAlive;
+    void* allocate(std::size_t typeIndex, std::size_t size, std::size_t alignment);
+    void deallocate(std::size_t typeIndex, void* slot);
+  };
+
+public:
+
+  /**
+   * Allocator for std::allocate_shared(), allocates single objects (including their
+   * reference counts) from the pool of their type, arrays from the heap.
+   */
+  template <class T>
+  class Allocator {
+
+  public:
+
+    typedef T value_type;
+
+    explicit Allocator(PoolSet* poolSet)
+        : poolSet_(poolSet) {
+    }
+
+    template <class U>
+    Allocator(const Allocator<U>& other)
+        : poolSet_(other.poolSet_) {
+    }
+
+    T* allocate(std::size_t n) {
+      if (n != 1) {
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+      }
+      return static_cast<T*>(poolSet_->allocate(getTypeIndex_<T>(), sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* p, std::size_t n) {
+      if (n != 1) {
+        ::operator delete(p);
+        return;
+      }
+      poolSet_->deallocate(getTypeIndex_<T>(), p);
+    }
+
+    template <class U>
+    bool operator==(const Allocator<U>& other) const {
+      return poolSet_ == other.poolSet_;
+    }
+
+    template <class U>
+    bool operator!=(const Allocator<U>& other) const {
+      return poolSet_ != other.poolSet_;
+    }
+
+  protected:
+
+    template <class U> friend class Allocator;
+
+    PoolSet* poolSet_;
+
+  };
+
+  /**
+   * Constructor.
+   * \param blockSize size of memory blocks in bytes
+   */
+  explicit SceneArena(std::size_t blockSize = DEFAULT_BLOCK_SIZE);
+
+  /**
+   * Destructor, releases memory blocks if all objects have been destroyed,
+   * otherwise they are released with the last object.
+   */
+  virtual ~SceneArena();
+
+  SceneArena(const SceneArena&) = delete;
+  SceneArena& operator=(const SceneArena&) = delete;
+
+  /**
+   * Create shared pointer.
+   * \param blockSize size of memory blocks in bytes
+   */
+  static SceneArenaSP create(std::size_t blockSize = DEFAULT_BLOCK_SIZE);
+
+  /**
+   * Create node or core of type T from the pool of its type.
+   * \param args constructor arguments
+   * \return shared pointer to the new object
+   */
+  template <class T, class... Args>
+  std::shared_ptr<T> make(Args&&... args) {
+    return std::allocate_shared<T>(Allocator<T>(poolSet_), std::forward<Args>(args)...);
+  }
+
+  /**
+   * Get number of objects currently allocated from the arena.
+   */
+  std::size_t getNObjects() const;
+
+  /**
+   * Get total size of memory blocks in bytes.
+   */
+  std::size_t getMemorySize() const;
+
+  static const std::size_t DEFAULT_BLOCK_SIZE = 64 << 10;
+
+protected:
+
+  /**
+   * Get index of pool for type T, which is assigned on first use.
+   */
+  template <class T>
+  static std::size_t getTypeIndex_() {
+    static const std::size_t index = nTypes_++;
+    return index;
+  }
+
+protected:
+
+  PoolSet* poolSet_;
+  static std::size_t nTypes_;
+
+};
+
+
+} /* namespace scg */
+
+#endif /* SCENEARENA_H_ */
@@ -0,0 +1,326 @@
+/**
+ * \file SceneCompiler.cpp
+ *
+ * \author Projektgruppe "Zahnradapparatus"
+ */
+
+/*
+ * Copyright 2026 Projektgruppe "Zahnradapparatus"
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cassert>
+#include "Camera.h"
+#include "DrawBatcher.h"
+#include "Group.h"
+#include "InstancedShape.h"
+#include "Light.h"
+#include "LightPosition.h"
+#include "RenderState.h"
+#include "SceneCompiler.h"
+#include "Shape.h"
+#include "Transformation.h"
+
+namespace scg {
+
+
+SceneCompiler::SceneCompiler(RenderState* renderState)
+    : Traverser(renderState), scene_(nullptr), structureGeneration_(0),
+      isBatchingEnabled_(false), currentState_(-1) {
+}
+
+
+SceneCompiler::~SceneCompiler() {
+}
+
+
+void SceneCompiler::setBatchingEnabled(bool isEnabled) {
+  isBatchingEnabled_ = isEnabled;
+  if (!isEnabled) {
+    drawBatcher_.reset();
+  }
+}
+
+
+bool SceneCompiler::update(Node* scene) {
+  assert(scene);
+  if (scene == scene_ && structureGeneration_ == scene->getStructureGeneration()) {
+    return false;
+  }
+  scene_ = scene;
+  structureGeneration_ = scene->getStructureGeneration();
+
+  // traverse scene, the root transformation (identity) has index 0
+  transforms_.clear();
+  states_.clear();
+  drawItems_.clear();
+  cameraIndices_.clear();
+  lightPositions_.clear();
+  transforms_.push_back({ nullptr, -1 });
+  transformStack_.assign(1, 0);
+  stateStack_.clear();
+  scene->traverse(this);
+  assert(transformStack_.size() == 1);
+  assert(stateStack_.empty());
+  modelViewMatrices_.assign(transforms_.size(), glm::mat4(1.0f));
+  return true;
+}
+
+
+void SceneCompiler::render() {
+  assert(scene_);
+  renderState_->projectionStack.pushMatrix();
+  renderState_->modelViewStack.pushMatrix();
+
+  // save camera projection and view transformation, update light positions
+  // (cf. PreTraverser)
+  for (int index : cameraIndices_) {
+    Camera* camera = static_cast<Camera*>(transforms_[index].node);
+    renderState_->modelViewStack.setMatrix(computeWorldMatrix_(index));
+    renderState_->setProjection(camera->getProjection());
+    renderState_->setViewTransform(camera->getViewTransform(renderState_));
+  }
+  for (const auto& lightPosition : lightPositions_) {
+    lightPosition.first->getLight()->setModelTransform(computeWorldMatrix_(lightPosition.second));
+  }
+
+  // apply projection and view transformation, update model-view matrices
+  // from cached world matrices or, in shared sub-trees, from the parent's
+  // model-view matrix (cf. RenderTraverser)
+  renderState_->modelViewStack.setIdentity();
+  renderState_->applyProjectionViewTransform();
+  const glm::mat4& viewTransform = renderState_->getViewTransform();
+  modelViewMatrices_[0] = renderState_->modelViewStack.getMatrix();
+  const int nTransforms = static_cast<int>(transforms_.size());
+  for (int i = 1; i < nTransforms; ++i) {
+    const TransformItem& item = transforms_[i];
+    const glm::mat4& worldMatrix = item.node->getWorldMatrix();
+    if (item.node->isWorldMatrixUnique()) {
+      modelViewMatrices_[i] = viewTransform * worldMatrix;
+    }
+    else {
+      modelViewMatrices_[i] = modelViewMatrices_[item.parentIndex] * item.node->getMatrix();
+    }
+  }
+
+  // draw items, switching render states and model-view matrix only on changes
+  if (isBatchingEnabled_ && !drawBatcher_) {
+    drawBatcher_.reset(new DrawBatcher());
+  }
+  int matrixIndex = 0;
+  for (const DrawItem& item : drawItems_) {
+    if (item.stateIndex != currentState_) {
+      switchState_(item.stateIndex);
+    }
+    if (item.matrixIndex != matrixIndex) {
+      matrixIndex = item.matrixIndex;
+      renderState_->modelViewStack.setMatrix(modelViewMatrices_[matrixIndex]);
+    }
+    if (Traverser::isCulled(item.node)) {
+      continue;
+    }
+    switch (item.type) {
+      case DrawItemType::SHAPE: {
+        Shape* shape = static_cast<Shape*>(item.node);
+        if (!drawBatcher_ || !drawBatcher_->addShape(shape, renderState_)) {
+          shape->render(renderState_);
+        }
+        break;
+      }
+      case DrawItemType::INSTANCED_SHAPE:
+        item.node->render(renderState_);
+        break;
+      case DrawItemType::CAMERA: {
+        Camera* camera = static_cast<Camera*>(item.node);
+        flush_();
+        camera->render(renderState_);
+        camera->renderPost(renderState_);
+        break;
+      }
+    }
+  }
+  switchState_(-1);
+  flush_();
+
+  renderState_->modelViewStack.popMatrix();
+  renderState_->projectionStack.popMatrix();
+}
+
+
+int SceneCompiler::getNTransforms() const {
+  return static_cast<int>(transforms_.size());
+}
+
+
+int SceneCompiler::getNDrawItems() const {
+  return static_cast<int>(drawItems_.size());
+}
+
+
+bool SceneCompiler::isCulled(Node* node) {
+  // further structure changes below this node have to be propagated to the root again
+  node->isStructureCompiled_ = true;
+  return false;
+}
+
+
+void SceneCompiler::visitLightPosition(LightPosition* node) {
+  lightPositions_.push_back(std::make_pair(node, transformStack_.back()));
+}
+
+
+void SceneCompiler::visitShape(Shape* node) {
+  addDrawItem_(node, DrawItemType::SHAPE);
+}
+
+
+void SceneCompiler::visitInstancedShape(InstancedShape* node) {
+  addDrawItem_(node, DrawItemType::INSTANCED_SHAPE);
+}
+
+
+void SceneCompiler::visitCamera(Camera* node) {
+  // coordinate axes are drawn relative to the parent transformation
+  addDrawItem_(node, DrawItemType::CAMERA);
+  cameraIndices_.push_back(pushTransform_(node));
+}
+
+
+void SceneCompiler::visitPostCamera(Camera* node) {
+  transformStack_.pop_back();
+}
+
+
+void SceneCompiler::visitGroup(Group* node) {
+  if (node->getNCores() > 0) {
+    pushState_(node);
+  }
+}
+
+
+void SceneCompiler::visitPostGroup(Group* node) {
+  popState_(node);
+}
+
+
+void SceneCompiler::visitLight(Light* node) {
+  pushState_(node);
+}
+
+
+void SceneCompiler::visitPostLight(Light* node) {
+  popState_(node);
+}
+
+
+void SceneCompiler::visitTransformation(Transformation* node) {
+  pushTransform_(node);
+}
+
+
+void SceneCompiler::visitPostTransformation(Transformation* node) {
+  transformStack_.pop_back();
+}
+
+
+int SceneCompiler::pushTransform_(Transformation* node) {
+  const int index = static_cast<int>(transforms_.size());
+  transforms_.push_back({ node, transformStack_.back() });
+  transformStack_.push_back(index);
+  return index;
+}
+
+
+void SceneCompiler::pushState_(Composite* node) {
+  const int parentIndex = stateStack_.empty() ? -1 : stateStack_.back();
+  const int depth = stateStack_.empty() ? 1 : states_[parentIndex].depth + 1;
+  stateStack_.push_back(static_cast<int>(states_.size()));
+  states_.push_back({ node, parentIndex, depth });
+}
+
+
+void SceneCompiler::popState_(Composite* node) {
+  if (!stateStack_.empty() && states_[stateStack_.back()].node == node) {
+    stateStack_.pop_back();
+  }
+}
+
+
+void SceneCompiler::addDrawItem_(Node* node, DrawItemType type) {
+  drawItems_.push_back({ node, type, transformStack_.back(),
+      stateStack_.empty() ? -1 : stateStack_.back() });
+}
+
+
+glm::mat4 SceneCompiler::computeWorldMatrix_(int index) {
+  transformPath_.clear();
+  while (index > 0) {
+    Transformation* node = transforms_[index].node;
+    node->getWorldMatrix();
+    if (node->isWorldMatrixUnique()) {
+      break;
+    }
+    transformPath_.push_back(index);
+    index = transforms_[index].parentIndex;
+  }
+  glm::mat4 worldMatrix = index > 0 ? transforms_[index].node->getWorldMatrix() : glm::mat4(1.0f);
+  for (auto it = transformPath_.rbegin(); it != transformPath_.rend(); ++it) {
+    worldMatrix = worldMatrix * transforms_[*it].node->getMatrix();
+  }
+  return worldMatrix;
+}
+
+
+void SceneCompiler::switchState_(int stateIndex) {
+  // batched shapes have to be drawn with their own render state
+  flush_();
+
+  // post-process current states and collect new states up to the common enclosing state
+  auto getDepth = [this](int index) -> int {
+    return index < 0 ? 0 : states_[index].depth;
+  };
+  int current = currentState_;
+  int target = stateIndex;
+  statePath_.clear();
+  while (getDepth(current) > getDepth(target)) {
+    states_[current].node->renderPost(renderState_);
+    current = states_[current].parentIndex;
+  }
+  while (getDepth(target) > getDepth(current)) {
+    statePath_.push_back(target);
+    target = states_[target].parentIndex;
+  }
+  while (current != target) {
+    states_[current].node->renderPost(renderState_);
+    current = states_[current].parentIndex;
+    statePath_.push_back(target);
+    target = states_[target].parentIndex;
+  }
+
+  // process new states, outermost first
+  for (auto it = statePath_.rbegin(); it != statePath_.rend(); ++it) {
+    states_[*it].node->render(renderState_);
+  }
+  currentState_ = stateIndex;
+}
+
+
+void SceneCompiler::flush_() {
+  if (drawBatcher_) {
+    drawBatcher_->flush(renderState_);
+  }
+}
+
+
+} /* namespace scg */
@@ -0,0 +1,274 @@
+/**
+ * \file SceneCompiler.h
+ * \brief A traverser that compiles the scene graph into linear arrays of transformations,
+ *    render states, and draw items, which are rendered without traversing the node tree.
+ *
+ * \author Projektgruppe "Zahnradapparatus"
+ */
+
+/*
+ * Copyright 2026 Projektgruppe "Zahnradapparatus"
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SCENECOMPILER_H_
+#define SCENECOMPILER_H_
+
+#include <utility>
+#include <vector>
+#include "Traverser.h"
+#include "scg_glm.h"
+#include "scg_internals.h"
+
+namespace scg {
+
+
+/**
+ * \brief A traverser that compiles the scene graph into linear arrays of transformations,
+ *    render states, and draw items, which are rendered without traversing the node tree.
+ *
+ * The compiled scene consists of
+ * - a transformation array of all Transformation and Camera nodes, from whose
+ *   cached world matrices (cf. Transformation::getWorldMatrix()) the model-view
+ *   matrices are computed by a single loop; nodes of shared sub-trees occur once
+ *   per path and multiply the model-view matrix of their parent by the local matrix,
+ * - a render state array of Group nodes with cores and Light nodes, each referring
+ *   to its enclosing state, and
+ * - an array of draw items (Shape, InstancedShape, and Camera nodes) in traversal order,
+ *   each holding the index of its world matrix and of its render state (state key).
+ *
+ * render() replaces both traversals of StandardRenderer::render(): it updates the
+ * model-view matrices, camera projection and view transformation, and light positions,
+ * and draws the items, switching render states only between items with different
+ * state keys. The result is the same as by a PreTraverser and a RenderTraverser.
+ *
+ * The scene is recompiled by update() only when the structure of its node tree has
+ * changed (cf. Node::getStructureGeneration()), i.e., when nodes have been added,
+ * removed, shown or hidden, or cores have been added to groups below the root.
+ * Structure changes in other scene graphs or in hidden sub-trees, and changing
+ * transformation matrices, shape cores, or light properties do not require
+ * recompilation, since the latter are read when rendering.
+ */
+class SceneCompiler: public Traverser {
+
+public:
+
+  /**
+   * Constructor.
+   */
+  SceneCompiler(RenderState* renderState);
+
+  /**
+   * Destructor.
+   */
+  virtual ~SceneCompiler();
+
+  /**
+   * Enable or disable batching of shapes stored in geometry arenas and automatic
+   * instancing of shapes with equal geometry and cores (cf. DrawBatcher).
+   * Default: disabled.
+   */
+  void setBatchingEnabled(bool isEnabled);
+
+  /**
+   * Compile scene if it differs from the compiled scene or its structure has changed.
+   * \return true if the scene has been compiled
+   */
+  bool update(Node* scene);
+
+  /**
+   * Render compiled scene, called by StandardRenderer::render() instead of
+   * the PreTraverser and RenderTraverser passes.
+   */
+  void render();
+
+  /**
+   * Get number of transformations in compiled scene (including the root).
+   */
+  int getNTransforms() const;
+
+  /**
+   * Get number of draw items in compiled scene.
+   */
+  int getNDrawItems() const;
+
+  /**
+   * Never skip nodes while compiling, draw items are culled by render().
+   * Marks the structure of the visited node as compiled.
+   */
+  virtual bool isCulled(Node* node);
+
+  // leaf nodes
+
+  /**
+   * Visit LightPosition node: add light position to be updated by render().
+   */
+  virtual void visitLightPosition(LightPosition* node);
+
+  /**
+   * Visit Shape node: add draw item.
+   */
+  virtual void visitShape(Shape* node);
+
+  /**
+   * Visit InstancedShape node: add draw item (not batched).
+   */
+  virtual void visitInstancedShape(InstancedShape* node);
+
+  // composite nodes
+
+  /**
+   * Visit Camera node: add draw item for coordinate axes and transformation.
+   */
+  virtual void visitCamera(Camera* node);
+
+  /**
+   * Visit Camera node after traversing sub-tree.
+   */
+  virtual void visitPostCamera(Camera* node);
+
+  /**
+   * Visit Group node: add render state if the group has cores.
+   */
+  virtual void visitGroup(Group* node);
+
+  /**
+   * Visit Group node after traversing sub-tree.
+   */
+  virtual void visitPostGroup(Group* node);
+
+  /**
+   * Visit Light node: add render state.
+   */
+  virtual void visitLight(Light* node);
+
+  /**
+   * Visit Light node after traversing sub-tree.
+   */
+  virtual void visitPostLight(Light* node);
+
+  /**
+   * Visit Transformation node: add transformation.
+   */
+  virtual void visitTransformation(Transformation* node);
+
+  /**
+   * Visit Transformation node after traversing sub-tree.
+   */
+  virtual void visitPostTransformation(Transformation* node);
+
+protected:
+
+  /**
+   * Group or Light node with index of enclosing render state (-1 for none)
+   * and nesting depth (1 for outermost state).
+   */
+  struct StateItem {
+    Composite* node;
+    int parentIndex;
+    int depth;
+  };
+
+  /**
+   * Type of draw item, determines how the node is rendered.
+   */
+  enum class DrawItemType {
+    SHAPE,              // Shape, may be batched
+    INSTANCED_SHAPE,    // InstancedShape
+    CAMERA              // Camera coordinate axes (if enabled)
+  };
+
+  /**
+   * Transformation or Camera node with index of parent transformation (0 for root).
+   */
+  struct TransformItem {
+    Transformation* node;
+    int parentIndex;
+  };
+
+  /**
+   * Node to be drawn with world matrix index and render state index (state key).
+   */
+  struct DrawItem {
+    Node* node;
+    DrawItemType type;
+    int matrixIndex;
+    int stateIndex;
+  };
+
+  /**
+   * Add transformation to current transformation (parent).
+   * \return index of the new transformation
+   */
+  int pushTransform_(Transformation* node);
+
+  /**
+   * Add render state to current render state (parent).
+   */
+  void pushState_(Composite* node);
+
+  /**
+   * Remove render state of given node from stack of enclosing states (if any).
+   */
+  void popState_(Composite* node);
+
+  /**
+   * Add draw item with current transformation and render state.
+   */
+  void addDrawItem_(Node* node, DrawItemType type);
+
+  /**
+   * Compute world matrix of transformation along its path in the compiled scene,
+   * i.e., multiply local matrices from the nearest transformation with unique world matrix.
+   */
+  glm::mat4 computeWorldMatrix_(int index);
+
+  /**
+   * Switch from current render state to given render state, i.e., post-process
+   * states up to the common enclosing state and process states down to the new one.
+   */
+  void switchState_(int stateIndex);
+
+  /**
+   * Draw shapes that have been batched but not drawn yet.
+   */
+  void flush_();
+
+protected:
+
+  Node* scene_;
+  unsigned int structureGeneration_;
+  bool isBatchingEnabled_;
+  DrawBatcherUP drawBatcher_;
+
+  std::vector<TransformItem> transforms_;
+  std::vector<glm::mat4> modelViewMatrices_;
+  std::vector<StateItem> states_;
+  std::vector<DrawItem> drawItems_;
+  std::vector<int> cameraIndices_;
+  std::vector<std::pair<LightPosition*, int>> lightPositions_;
+
+  // compilation and rendering state
+  std::vector<int> transformStack_;
+  std::vector<int> stateStack_;
+  std::vector<int> statePath_;
+  std::vector<int> transformPath_;
+  int currentState_;
+
+};
+
+
+} /* namespace scg */
+
+#endif /* SCENECOMPILER_H_ */
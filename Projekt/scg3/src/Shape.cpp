@@ -57,6 +57,7 @@ ShapeSP Shape::create(GeometryCoreSP geometryCore) {
 Shape* Shape::addCore(CoreSP core) {
   // Note: check here for disallowed core types (if any)
   cores_.push_back(core);
+  invalidateBoundingBox();
   return this;
 }
 
@@ -95,4 +96,16 @@ void Shape::render(RenderState* renderState) {
 }
 
 
+BoundingBox Shape::computeBoundingBox_() {
+  BoundingBox result;
+  for (auto& core : cores_) {
+    auto geometryCore = dynamic_cast<GeometryCore*>(core.get());
+    if (geometryCore) {
+      result.extend(geometryCore->getBoundingBox());
+    }
+  }
+  return result;
+}
+
+
 } /* namespace scg */
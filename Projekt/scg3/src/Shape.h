@@ -41,6 +41,8 @@ namespace scg {
  */
 class Shape: public Leaf {
 
+  friend class DrawBatcher;
+
 public:
 
   /**
@@ -88,7 +90,7 @@ public:
   /**
    * Get approximate number of triangles, called by InfoTraverser::visitShape().
    */
-  int getNTriangles() const;
+  virtual int getNTriangles() const;
 
   /**
    * Accept traverser (visitor pattern).
@@ -100,6 +102,13 @@ public:
    */
   virtual void render(RenderState* renderState);
 
+protected:
+
+  /**
+   * Compute bounding box as union of the bounding boxes of all geometry cores.
+   */
+  virtual BoundingBox computeBoundingBox_();
+
 };
 
 
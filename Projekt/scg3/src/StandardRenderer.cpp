@@ -28,6 +28,7 @@
 #include "PreTraverser.h"
 #include "RenderState.h"
 #include "RenderTraverser.h"
+#include "SceneCompiler.h"
 #include "StandardRenderer.h"
 #include "Viewer.h"
 
@@ -37,7 +38,9 @@ namespace scg {
 StandardRenderer::StandardRenderer()
     : infoTraverser_(new InfoTraverser(renderState_.get())),
       preTraverser_(new PreTraverser(renderState_.get())),
-      renderTraverser_(new RenderTraverser(renderState_.get())) {
+      renderTraverser_(new RenderTraverser(renderState_.get())),
+      sceneCompiler_(new SceneCompiler(renderState_.get())),
+      isCompilationEnabled_(false) {
 }
 
 
@@ -59,12 +62,35 @@ void StandardRenderer::initViewer(Viewer *viewer, FrameBufferSize *fbSize) {
 
 std::string StandardRenderer::getInfo() {
   assert(scene_);
-  scene_->traverse(infoTraverser_.get());
+  infoTraverser_->clear();
+  if (infoTraverser_->isCullingEnabled()) {
+    // cull against projection and view transformation of last frame
+    renderState_->projectionStack.pushMatrix();
+    renderState_->modelViewStack.pushMatrix();
+    renderState_->modelViewStack.setIdentity();
+    renderState_->applyProjectionViewTransform();
+    scene_->traverse(infoTraverser_.get());
+    renderState_->modelViewStack.popMatrix();
+    renderState_->projectionStack.popMatrix();
+  }
+  else {
+    scene_->traverse(infoTraverser_.get());
+  }
   std::stringstream stream;
   stream << "No. of nodes: " << infoTraverser_->getNNodes() << std::endl
       << "No. of core pointers: " << infoTraverser_->getNCores() << std::endl
-      << "No. of triangles (approx.): " << infoTraverser_->getNTriangles() << std::endl
-      << std::ends;
+      << "No. of triangles (approx.): " << infoTraverser_->getNTriangles() << std::endl;
+  if (infoTraverser_->isCullingEnabled()) {
+    stream << "No. of culled nodes: " << infoTraverser_->getNCulledNodes() << std::endl;
+  }
+  const unsigned long nHits = infoTraverser_->getNWorldMatrixHits();
+  const unsigned long nLookups = nHits + infoTraverser_->getNWorldMatrixMisses();
+  stream << "World matrix cache hits/lookups since last info: " << nHits << "/" << nLookups;
+  if (nLookups > 0) {
+    stream << " (" << static_cast<int>(100.0 * nHits / nLookups) << "%)";
+  }
+  stream << std::endl;
+  stream << std::ends;
   return stream.str();
 }
 
@@ -77,6 +103,9 @@ void StandardRenderer::render() {
   // check if camera projection has to be updated
   if (viewer_->isWindowResized()) {
     camera_->updateProjection();
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    renderState_->setViewport(glm::make_vec4(viewport));
   }
 
   // save projection and modelview matrices, set modelview matrix to identity
@@ -84,14 +113,22 @@ void StandardRenderer::render() {
   renderState_->modelViewStack.pushMatrix();
   renderState_->modelViewStack.setIdentity();
 
-  // pass 1: save camera projection and view transformation
-  scene_->traverse(preTraverser_.get());
+  if (isCompilationEnabled_) {
+    // recompile scene if its structure has changed, render linear arrays
+    sceneCompiler_->update(scene_.get());
+    sceneCompiler_->render();
+  }
+  else {
+    // pass 1: save camera projection and view transformation
+    scene_->traverse(preTraverser_.get());
 
-  // apply projection and view transformation as determined in previous frame
-  renderState_->applyProjectionViewTransform();
+    // apply projection and view transformation as determined in previous frame
+    renderState_->applyProjectionViewTransform();
 
-  // pass 2: render scene
-  scene_->traverse(renderTraverser_.get());
+    // pass 2: render scene
+    scene_->traverse(renderTraverser_.get());
+    renderTraverser_->flush();
+  }
 
   // restore projection and modelview matrices
   renderState_->modelViewStack.popMatrix();
@@ -99,4 +136,22 @@ void StandardRenderer::render() {
 }
 
 
+void StandardRenderer::setBatchingEnabled(bool isEnabled) {
+  renderTraverser_->setBatchingEnabled(isEnabled);
+  sceneCompiler_->setBatchingEnabled(isEnabled);
+}
+
+
+void StandardRenderer::setCullingEnabled(bool isEnabled) {
+  infoTraverser_->setCullingEnabled(isEnabled);
+  renderTraverser_->setCullingEnabled(isEnabled);
+  sceneCompiler_->setCullingEnabled(isEnabled);
+}
+
+
+void StandardRenderer::setCompilationEnabled(bool isEnabled) {
+  isCompilationEnabled_ = isEnabled;
+}
+
+
 } /* namespace scg */
@@ -36,6 +36,9 @@ namespace scg {
  * \brief A standard renderer that uses a PreTraverser, a RenderTraverser, and an
  *    InfoTraverser.
  *
+ * Optionally, the scene is compiled into linear arrays by a SceneCompiler, which then
+ * replaces the PreTraverser and RenderTraverser passes (cf. setCompilationEnabled()).
+ *
  * The stencil buffer is activated for later use in projection shadows and planar
  * reflections.
  */
@@ -78,11 +81,35 @@ public:
    */
   virtual void render();
 
+  /**
+   * Enable or disable batching of shapes stored in geometry arenas (cf. DrawBatcher,
+   * GeometryCoreFactory::setGeometryArena()) and automatic instancing of shapes that
+   * differ only in their transformation. Default: disabled.
+   */
+  void setBatchingEnabled(bool isEnabled);
+
+  /**
+   * Enable or disable view-frustum culling of nodes by their bounding boxes
+   * (cf. Traverser::setCullingEnabled()). If enabled, getInfo() reports the
+   * number of culled nodes for the current view. Default: disabled.
+   */
+  void setCullingEnabled(bool isEnabled);
+
+  /**
+   * Enable or disable compilation of the scene into linear arrays of transformations,
+   * render states, and draw items (cf. SceneCompiler), which are rendered without
+   * traversing the node tree. The scene is recompiled only when its structure changes.
+   * Default: disabled.
+   */
+  void setCompilationEnabled(bool isEnabled);
+
 protected:
 
   InfoTraverserUP infoTraverser_;
   PreTraverserUP preTraverser_;
   RenderTraverserUP renderTraverser_;
+  SceneCompilerUP sceneCompiler_;
+  bool isCompilationEnabled_;
 
 };
 
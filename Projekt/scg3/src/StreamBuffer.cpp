@@ -0,0 +1,147 @@
+/**
+ * \file StreamBuffer.cpp
+ *
+ * \author Projektgruppe "Zahnradapparatus"
+ */
+
+/*
+ * Copyright 2026 Projektgruppe "Zahnradapparatus"
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cassert>
+#include <memory>
+#include "StreamBuffer.h"
+#include "scg_utilities.h"
+
+namespace scg {
+
+
+StreamBuffer::StreamBuffer(GLsizeiptr regionSize, int nRegions)
+    : buffer_(0), regionSize_(regionSize), nRegions_(nRegions), region_(nRegions - 1),
+      persistentData_(nullptr), fences_(nRegions, nullptr) {
+  assert(regionSize > 0 && nRegions > 0);
+  const GLsizeiptr size = regionSize_ * nRegions_;
+  glGenBuffers(1, &buffer_);
+  glBindBuffer(GL_COPY_WRITE_BUFFER, buffer_);
+  assert(glIsBuffer(buffer_));
+  if (isGLVersionSupported(4, 4) || isGLExtensionSupported("GL_ARB_buffer_storage")) {
+    const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    glBufferStorage(GL_COPY_WRITE_BUFFER, size, nullptr, flags);
+    persistentData_ = static_cast<GLubyte*>(glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, size, flags));
+  }
+  else {
+    glBufferData(GL_COPY_WRITE_BUFFER, size, nullptr, GL_STREAM_DRAW);
+  }
+  glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+  assert(!checkGLError());
+}
+
+
+StreamBuffer::~StreamBuffer() {
+  if (isGLContextActive()) {
+    for (auto fence : fences_) {
+      if (fence) {
+        glDeleteSync(fence);
+      }
+    }
+    if (persistentData_) {
+      glBindBuffer(GL_COPY_WRITE_BUFFER, buffer_);
+      glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+      glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    }
+    glDeleteBuffers(1, &buffer_);
+  }
+}
+
+
+StreamBufferSP StreamBuffer::create(GLsizeiptr regionSize, int nRegions) {
+  return std::make_shared<StreamBuffer>(regionSize, nRegions);
+}
+
+
+GLvoid* StreamBuffer::map() {
+  region_ = (region_ + 1) % nRegions_;
+  waitForRegion_(region_);
+  if (persistentData_) {
+    return persistentData_ + region_ * regionSize_;
+  }
+
+  // region is not read by the GPU any more, hence no implicit synchronization is needed
+  glBindBuffer(GL_COPY_WRITE_BUFFER, buffer_);
+  GLvoid* result = glMapBufferRange(GL_COPY_WRITE_BUFFER, region_ * regionSize_, regionSize_,
+      GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+  glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+  assert(result);
+  return result;
+}
+
+
+void StreamBuffer::unmap() {
+  if (!persistentData_) {
+    glBindBuffer(GL_COPY_WRITE_BUFFER, buffer_);
+    glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+  }
+}
+
+
+void StreamBuffer::lock() {
+  GLsync& fence = fences_[region_];
+  if (fence) {
+    glDeleteSync(fence);
+  }
+  fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+
+GLuint StreamBuffer::getBuffer() const {
+  return buffer_;
+}
+
+
+int StreamBuffer::getRegion() const {
+  return region_;
+}
+
+
+GLsizeiptr StreamBuffer::getRegionSize() const {
+  return regionSize_;
+}
+
+
+bool StreamBuffer::isPersistent() const {
+  return persistentData_ != nullptr;
+}
+
+
+void StreamBuffer::waitForRegion_(int region) {
+  GLsync& fence = fences_[region];
+  if (!fence) {
+    return;
+  }
+  // flush commands on first wait only, such that the fence is guaranteed to be signaled
+  const GLuint64 timeout = 1000000;  // nanoseconds
+  GLenum status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+  while (status == GL_TIMEOUT_EXPIRED) {
+    status = glClientWaitSync(fence, 0, timeout);
+  }
+  assert(status != GL_WAIT_FAILED);
+  glDeleteSync(fence);
+  fence = nullptr;
+}
+
+
+} /* namespace scg */
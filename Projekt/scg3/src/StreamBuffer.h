@@ -0,0 +1,150 @@
+/**
+ * \file StreamBuffer.h
+ * \brief A vertex buffer divided into regions that are rewritten in turn, for geometry that changes every frame.
+ *
+ * \author Projektgruppe "Zahnradapparatus"
+ */
+
+/*
+ * Copyright 2026 Projektgruppe "Zahnradapparatus"
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STREAMBUFFER_H_
+#define STREAMBUFFER_H_
+
+#include <vector>
+#include "scg_glew.h"
+#include "scg_internals.h"
+
+namespace scg {
+
+
+/**
+ * \brief A vertex buffer divided into regions that are rewritten in turn, for geometry
+ * that changes every frame.
+ *
+ * Each call of map() advances to the next region (ring buffer) and returns a pointer
+ * to it. Before the region is returned, the CPU waits for the fence that lock() has
+ * inserted after the last draw call reading it. With three regions, the CPU writes one
+ * frame while the GPU still reads the previous ones, so it rarely waits and never
+ * reallocates the buffer.
+ *
+ * If buffer storage is supported (OpenGL 4.4 or ARB_buffer_storage), the buffer is
+ * mapped persistently and coherently once. Otherwise, each region is mapped by
+ * glMapBufferRange() without synchronization, which relies on the same fences.
+ *
+ * Example:
+ * \code
+ * auto buffer = StreamBuffer::create(nVertices * sizeof(glm::vec3));
+ * // each frame
+ * auto vertices = static_cast<glm::vec3*>(buffer->map());
+ * // write vertices...
+ * buffer->unmap();
+ * // draw from buffer, starting at vertex buffer->getRegion() * nVertices
+ * buffer->lock();
+ * \endcode
+ */
+class StreamBuffer {
+
+public:
+
+  /**
+   * Constructor.
+   *
+   * \param regionSize size of each region in bytes
+   * \param nRegions number of regions (default: triple buffering)
+   */
+  StreamBuffer(GLsizeiptr regionSize, int nRegions = DEFAULT_N_REGIONS);
+
+  /**
+   * Destructor.
+   */
+  virtual ~StreamBuffer();
+
+  /**
+   * Create shared pointer.
+   */
+  static StreamBufferSP create(GLsizeiptr regionSize, int nRegions = DEFAULT_N_REGIONS);
+
+  /**
+   * Advance to next region and get pointer for writing it. The previous contents of
+   * the region are undefined.
+   */
+  GLvoid* map();
+
+  /**
+   * Finish writing the current region.
+   */
+  void unmap();
+
+  /**
+   * Insert fence after the draw calls that read the current region, to be called
+   * after each draw call (only the last fence of a region is kept).
+   */
+  void lock();
+
+  /**
+   * Get buffer object.
+   */
+  GLuint getBuffer() const;
+
+  /**
+   * Get index of current region.
+   */
+  int getRegion() const;
+
+  /**
+   * Get size of each region in bytes.
+   */
+  GLsizeiptr getRegionSize() const;
+
+  /**
+   * Check if buffer is mapped persistently.
+   */
+  bool isPersistent() const;
+
+public:
+
+  static const int DEFAULT_N_REGIONS = 3;
+
+protected:
+
+  /**
+   * Wait until the GPU has finished reading the given region.
+   */
+  void waitForRegion_(int region);
+
+protected:
+
+  GLuint buffer_;
+  GLsizeiptr regionSize_;
+  int nRegions_;
+  int region_;
+  GLubyte* persistentData_;
+  std::vector<GLsync> fences_;
+
+private:
+
+  /**
+   * Disallow copy constructor and assignment operator.
+   */
+  SCG_DISALLOW_COPY_AND_ASSIGN(StreamBuffer);
+
+};
+
+
+} /* namespace scg */
+
+#endif /* STREAMBUFFER_H_ */
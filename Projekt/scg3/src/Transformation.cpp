@@ -21,6 +21,9 @@
  * limitations under the License.
  */
 
+#include <cassert>
+#include <utility>
+#include <vector>
 #include "RenderState.h"
 #include "Transformation.h"
 #include "Traverser.h"
@@ -28,8 +31,13 @@
 namespace scg {
 
 
+unsigned long Transformation::nWorldMatrixHits_ = 0;
+unsigned long Transformation::nWorldMatrixMisses_ = 0;
+
+
 Transformation::Transformation()
-    : matrix_(1.0f) {
+    : matrix_(1.0f), worldMatrix_(1.0f), isWorldMatrixValid_(false),
+      isWorldMatrixUnique_(true) {
 }
 
 
@@ -49,12 +57,16 @@ const glm::mat4& Transformation::getMatrix() const {
 
 Transformation* Transformation::setMatrix(const glm::mat4& matrix) {
   matrix_ = matrix;
+  invalidateWorldMatrix();
+  invalidateBoundingBox();
   return this;
 }
 
 
 Transformation* Transformation::translate(glm::vec3 translation) {
   matrix_ = glm::translate(matrix_, translation);
+  invalidateWorldMatrix();
+  invalidateBoundingBox();
   return this;
 }
 
@@ -62,16 +74,69 @@ Transformation* Transformation::translate(glm::vec3 translation) {
 
 Transformation* Transformation::rotateRad(GLfloat angleRad, glm::vec3 axis) {
   matrix_ = glm::rotate(matrix_, angleRad, axis);
+  invalidateWorldMatrix();
+  invalidateBoundingBox();
   return this;
 }
 
 
 Transformation* Transformation::scale(glm::vec3 scaling) {
   matrix_ = glm::scale(matrix_, scaling);
+  invalidateWorldMatrix();
+  invalidateBoundingBox();
   return this;
 }
 
 
+const glm::mat4& Transformation::getWorldMatrix() {
+  if (isWorldMatrixValid_) {
+    ++nWorldMatrixHits_;
+    return worldMatrix_;
+  }
+
+  // update outdated ancestors first (iteratively, outermost first)
+  bool isPathShared = false;
+  Transformation* parent = getParentTransformation_(&isPathShared);
+  if (parent && !parent->isWorldMatrixValid_) {
+    std::vector<std::pair<Transformation*, bool>> ancestors;
+    Transformation* ancestor = parent;
+    while (ancestor && !ancestor->isWorldMatrixValid_) {
+      bool isAncestorPathShared = false;
+      Transformation* next = ancestor->getParentTransformation_(&isAncestorPathShared);
+      ancestors.push_back(std::make_pair(ancestor, isAncestorPathShared));
+      ancestor = next;
+    }
+    for (auto it = ancestors.rbegin(); it != ancestors.rend(); ++it) {
+      it->first->updateWorldMatrix_(ancestor, it->second);
+      ancestor = it->first;
+    }
+  }
+  updateWorldMatrix_(parent, isPathShared);
+  return worldMatrix_;
+}
+
+
+bool Transformation::isWorldMatrixUnique() const {
+  assert(isWorldMatrixValid_);
+  return isWorldMatrixUnique_;
+}
+
+
+unsigned long Transformation::getNWorldMatrixHits() {
+  return nWorldMatrixHits_;
+}
+
+
+unsigned long Transformation::getNWorldMatrixMisses() {
+  return nWorldMatrixMisses_;
+}
+
+
+void Transformation::resetWorldMatrixStatistics() {
+  nWorldMatrixHits_ = nWorldMatrixMisses_ = 0;
+}
+
+
 void Transformation::accept(Traverser *traverser) {
   traverser->visitTransformation(this);
 }
@@ -93,4 +158,31 @@ void Transformation::renderPost(RenderState* renderState) {
 }
 
 
+Transformation* Transformation::asTransformation_() {
+  return this;
+}
+
+
+bool Transformation::invalidateOwnWorldMatrix_() {
+  if (!isWorldMatrixValid_) {
+    return false;
+  }
+  isWorldMatrixValid_ = false;
+  return true;
+}
+
+
+void Transformation::updateWorldMatrix_(const Transformation* parent, bool isPathShared) {
+  worldMatrix_ = (parent ? parent->worldMatrix_ : IDENTITY_MATRIX) * matrix_;
+  isWorldMatrixUnique_ = !isPathShared && (!parent || parent->isWorldMatrixUnique_);
+  isWorldMatrixValid_ = true;
+  ++nWorldMatrixMisses_;
+}
+
+
+BoundingBox Transformation::computeBoundingBox_() {
+  return Composite::computeBoundingBox_().transform(matrix_);
+}
+
+
 } /* namespace scg */
@@ -38,6 +38,16 @@ class Traverser;
 
 /**
  * \brief A transformation node to be used to appy a transformation to the sub-tree (composite node).
+ *
+ * The world matrix, i.e., the product of the matrices of all ancestor transformations
+ * and the local matrix, is cached. Changing the local matrix or moving the node marks
+ * the world matrices of the sub-tree as outdated (cf. Node::invalidateWorldMatrix()),
+ * which are recomputed on demand by getWorldMatrix(). The numbers of cache hits and misses
+ * are counted for all transformations (cf. InfoTraverser).
+ *
+ * In a shared sub-tree (cf. Composite::addChild()), the world matrix refers to the path
+ * via the first parents, and traversers accumulate the local matrices along the current
+ * path instead (cf. isWorldMatrixUnique()).
  */
 class Transformation: public Composite {
 
@@ -101,6 +111,32 @@ public:
    */
   virtual Transformation* scale(glm::vec3 scaling);
 
+  /**
+   * Get world matrix, recompute it (and outdated ancestor world matrices) if it is outdated.
+   */
+  virtual const glm::mat4& getWorldMatrix();
+
+  /**
+   * Check if the world matrix is the same for all paths from the root, i.e., neither
+   * this node nor any of its ancestors is shared. Valid after getWorldMatrix().
+   */
+  bool isWorldMatrixUnique() const;
+
+  /**
+   * Get number of world matrices taken from the cache since the last reset.
+   */
+  static unsigned long getNWorldMatrixHits();
+
+  /**
+   * Get number of world matrices recomputed since the last reset.
+   */
+  static unsigned long getNWorldMatrixMisses();
+
+  /**
+   * Reset numbers of world matrix cache hits and misses.
+   */
+  static void resetWorldMatrixStatistics();
+
   /**
    * Accept traverser (visitor pattern).
    */
@@ -122,9 +158,40 @@ public:
    */
   virtual void renderPost(RenderState* renderState);
 
+protected:
+
+  /**
+   * Get this node as transformation node.
+   * \return this pointer
+   */
+  virtual Transformation* asTransformation_();
+
+  /**
+   * Mark cached world matrix as outdated.
+   * \return false if it has been outdated already
+   */
+  virtual bool invalidateOwnWorldMatrix_();
+
+  /**
+   * Recompute world matrix from world matrix of nearest ancestor transformation.
+   * \param parent nearest ancestor transformation (nullptr for none)
+   * \param isPathShared true if any node from this node up to the parent is shared
+   */
+  void updateWorldMatrix_(const Transformation* parent, bool isPathShared);
+
+  /**
+   * Compute bounding box of children, transformed by the local matrix.
+   */
+  virtual BoundingBox computeBoundingBox_();
+
 protected:
 
   glm::mat4 matrix_;
+  glm::mat4 worldMatrix_;
+  bool isWorldMatrixValid_;
+  bool isWorldMatrixUnique_;
+  static unsigned long nWorldMatrixHits_;
+  static unsigned long nWorldMatrixMisses_;
 
 };
 
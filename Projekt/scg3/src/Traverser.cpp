@@ -21,13 +21,16 @@
  * limitations under the License.
  */
 
+#include "InstancedShape.h"
+#include "Node.h"
+#include "RenderState.h"
 #include "Traverser.h"
 
 namespace scg {
 
 
 Traverser::Traverser(RenderState* renderState)
-    : renderState_(renderState) {
+    : renderState_(renderState), isCullingEnabled_(false) {
 }
 
 
@@ -35,6 +38,28 @@ Traverser::~Traverser() {
 }
 
 
+void Traverser::setCullingEnabled(bool isEnabled) {
+  isCullingEnabled_ = isEnabled;
+}
+
+
+bool Traverser::isCullingEnabled() const {
+  return isCullingEnabled_;
+}
+
+
+bool Traverser::isCulled(Node* node) {
+  if (!isCullingEnabled_) {
+    return false;
+  }
+
+  // bounding box is given in coordinates of the parent node, i.e., of the current model-view matrix
+  const BoundingBox& box = node->getBoundingBox();
+  return !box.isInfinite() && box.isOutsideFrustum(
+      renderState_->projectionStack.getMatrix() * renderState_->modelViewStack.getMatrix());
+}
+
+
 void Traverser::visitLightPosition(LightPosition* node) {
   // do nothing by default
 }
@@ -45,6 +70,11 @@ void Traverser::visitShape(Shape* node) {
 }
 
 
+void Traverser::visitInstancedShape(InstancedShape* node) {
+  visitShape(node);
+}
+
+
 void Traverser::visitCamera(Camera* node) {
   // do nothing by default
 }
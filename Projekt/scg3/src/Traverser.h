@@ -47,6 +47,25 @@ public:
    */
   virtual ~Traverser() = 0;
 
+  /**
+   * Enable or disable view-frustum culling, i.e., skipping nodes whose bounding box
+   * (cf. Node::getBoundingBox()) is outside the frustum of the current projection and
+   * model-view matrices. Requires a traverser that applies transformations.
+   * Default: disabled.
+   */
+  void setCullingEnabled(bool isEnabled);
+
+  /**
+   * Check if view-frustum culling is enabled.
+   */
+  bool isCullingEnabled() const;
+
+  /**
+   * Check if node and its sub-tree are to be skipped by view-frustum culling,
+   * called by Node::traverse() before the node is visited.
+   */
+  virtual bool isCulled(Node* node);
+
   // leaf nodes
 
   /**
@@ -59,6 +78,11 @@ public:
    */
   virtual void visitShape(Shape* node);
 
+  /**
+   * Visit InstancedShape node, calls visitShape() by default.
+   */
+  virtual void visitInstancedShape(InstancedShape* node);
+
   // composite nodes
 
   /**
@@ -104,6 +128,7 @@ public:
 protected:
 
   RenderState* renderState_;
+  bool isCullingEnabled_;
 
 };
 
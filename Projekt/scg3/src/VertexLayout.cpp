@@ -0,0 +1,120 @@
+/**
+ * \file VertexLayout.cpp
+ *
+ * \author Projektgruppe "Zahnradapparatus"
+ */
+
+/*
+ * Copyright 2026 Projektgruppe "Zahnradapparatus"
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+#include <stdexcept>
+#include "VertexLayout.h"
+
+namespace scg {
+
+
+VertexLayout::VertexLayout()
+    : stride_(0) {
+}
+
+
+VertexLayout& VertexLayout::addAttribute(GLuint location, GLint dim, GLenum type,
+    GLboolean isNormalized) {
+  Attribute attribute;
+  attribute.location = location;
+  attribute.dim = dim;
+  attribute.type = type;
+  attribute.isNormalized = isNormalized;
+  attribute.offset = stride_;
+  attributes_.push_back(attribute);
+
+  // keep offsets 4-byte aligned, as recommended for vertex fetch
+  stride_ += (getAttributeSize(dim, type) + 3) & ~3;
+  return *this;
+}
+
+
+const std::vector<VertexLayout::Attribute>& VertexLayout::getAttributes() const {
+  return attributes_;
+}
+
+
+GLsizei VertexLayout::getStride() const {
+  return stride_;
+}
+
+
+void VertexLayout::copyAttribute(GLuint location, const GLvoid* values, GLsizei nVertices,
+    GLvoid* vertexData) const {
+  for (auto& attribute : attributes_) {
+    if (attribute.location == location) {
+      const size_t size = static_cast<size_t>(getAttributeSize(attribute.dim, attribute.type));
+      const GLubyte* src = static_cast<const GLubyte*>(values);
+      GLubyte* dst = static_cast<GLubyte*>(vertexData) + attribute.offset;
+      for (GLsizei i = 0; i < nVertices; ++i) {
+        memcpy(dst, src, size);
+        src += size;
+        dst += stride_;
+      }
+      return;
+    }
+  }
+  throw std::runtime_error("Attribute location not in layout [VertexLayout::copyAttribute()]");
+}
+
+
+bool VertexLayout::operator==(const VertexLayout& other) const {
+  if (stride_ != other.stride_ || attributes_.size() != other.attributes_.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < attributes_.size(); ++i) {
+    const Attribute& a = attributes_[i];
+    const Attribute& b = other.attributes_[i];
+    if (a.location != b.location || a.dim != b.dim || a.type != b.type
+        || a.isNormalized != b.isNormalized || a.offset != b.offset) {
+      return false;
+    }
+  }
+  return true;
+}
+
+
+GLsizei VertexLayout::getAttributeSize(GLint dim, GLenum type) {
+  GLsizei result;
+  switch (type) {
+  case GL_BYTE:
+  case GL_UNSIGNED_BYTE:
+    result = dim;
+    break;
+  case GL_SHORT:
+  case GL_UNSIGNED_SHORT:
+  case GL_HALF_FLOAT:
+    result = 2 * dim;
+    break;
+  case GL_INT_2_10_10_10_REV:
+  case GL_UNSIGNED_INT_2_10_10_10_REV:
+    result = 4;
+    break;
+  default:
+    result = 4 * dim;
+    break;
+  }
+  return result;
+}
+
+
+} /* namespace scg */
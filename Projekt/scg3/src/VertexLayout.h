@@ -0,0 +1,124 @@
+/**
+ * \file VertexLayout.h
+ * \brief Layout of vertex attributes that are interleaved in one vertex buffer object.
+ *
+ * \author Projektgruppe "Zahnradapparatus"
+ */
+
+/*
+ * Copyright 2026 Projektgruppe "Zahnradapparatus"
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VERTEXLAYOUT_H_
+#define VERTEXLAYOUT_H_
+
+#include <vector>
+#include "scg_glew.h"
+
+namespace scg {
+
+
+/**
+ * \brief Layout of vertex attributes that are interleaved in one vertex buffer object.
+ *
+ * Each vertex occupies one block of getStride() bytes, containing its attribute values
+ * in the order the attributes have been added. Offsets are aligned to 4 bytes.
+ *
+ * Example:
+ * \code
+ * VertexLayout layout;
+ * layout.addAttribute(OGLConstants::VERTEX.location, 3)
+ *     .addAttribute(OGLConstants::NORMAL.location, 3);
+ * std::vector<GLubyte> vertexData(nVertices * layout.getStride());
+ * layout.copyAttribute(OGLConstants::VERTEX.location, vertices, nVertices, vertexData.data());
+ * layout.copyAttribute(OGLConstants::NORMAL.location, normals, nVertices, vertexData.data());
+ * core->addVertexData(layout, vertexData.data(), vertexData.size(), GL_STATIC_DRAW);
+ * \endcode
+ */
+class VertexLayout {
+
+public:
+
+  /**
+   * A vertex attribute and its position within a vertex.
+   */
+  struct Attribute {
+    GLuint location;
+    GLint dim;
+    GLenum type;
+    GLboolean isNormalized;
+    GLsizei offset;
+  };
+
+  /**
+   * Constructor, creates an empty layout.
+   */
+  VertexLayout();
+
+  /**
+   * Append attribute to each vertex.
+   *
+   * \param location attribute location
+   * \param dim dimension of each attribute value, 4 for packed types
+   * \param type GL_FLOAT, GL_HALF_FLOAT, GL_SHORT, GL_UNSIGNED_SHORT, GL_BYTE, GL_UNSIGNED_BYTE,
+   *   GL_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_2_10_10_10_REV (OpenGL 3.3)
+   * \param isNormalized GL_TRUE to map integer values to [-1, 1] (signed) or [0, 1] (unsigned)
+   * \return reference to this layout for method chaining
+   */
+  VertexLayout& addAttribute(GLuint location, GLint dim, GLenum type = GL_FLOAT,
+      GLboolean isNormalized = GL_FALSE);
+
+  /**
+   * Get attributes in the order of their offsets.
+   */
+  const std::vector<Attribute>& getAttributes() const;
+
+  /**
+   * Get distance between consecutive vertices in bytes.
+   */
+  GLsizei getStride() const;
+
+  /**
+   * Copy tightly packed attribute values into interleaved vertex data.
+   *
+   * \param location attribute location, as passed to addAttribute()
+   * \param values one value per vertex, in the attribute's type and dimension
+   * \param nVertices number of vertices to be copied
+   * \param vertexData interleaved vertex data of at least nVertices * getStride() bytes
+   */
+  void copyAttribute(GLuint location, const GLvoid* values, GLsizei nVertices,
+      GLvoid* vertexData) const;
+
+  /**
+   * Check if both layouts have the same attributes at the same offsets.
+   */
+  bool operator==(const VertexLayout& other) const;
+
+  /**
+   * Get size of one attribute value in bytes.
+   */
+  static GLsizei getAttributeSize(GLint dim, GLenum type);
+
+protected:
+
+  std::vector<Attribute> attributes_;
+  GLsizei stride_;
+
+};
+
+
+} /* namespace scg */
+
+#endif /* VERTEXLAYOUT_H_ */
@@ -28,6 +28,7 @@
 #include "Animation.h"
 #include "Camera.h"
 #include "Controller.h"
+#include "GeometryCoreFuture.h"
 #include "Group.h"
 #include "KeyboardController.h"
 #include "Light.h"
@@ -257,6 +258,9 @@ void Viewer::startMainLoop() {
   // main loop
   while (!glfwWindowShouldClose(window_)) {
 
+    // upload asynchronously loaded geometry
+    GeometryCoreFuture::updateAll();
+
     // check controllers for input and update animations
     processControllers_();
     processAnimations_();
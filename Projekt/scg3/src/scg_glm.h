@@ -38,6 +38,7 @@
 
 #include "../extern/glm/glm/glm.hpp"
 #include "../extern/glm/glm/gtc/matrix_transform.hpp"
+#include "../extern/glm/glm/gtc/packing.hpp"
 #include "../extern/glm/glm/gtc/quaternion.hpp"
 #include "../extern/glm/glm/gtc/type_ptr.hpp"
 
@@ -36,11 +36,13 @@ const OGLAttrib OGLConstants::TEX_COORD_0 = { "vTexCoord0", 3 };
 const OGLAttrib OGLConstants::TEX_COORD_1 = { "vTexCoord1", 4 };
 const OGLAttrib OGLConstants::TANGENT = { "vTangent", 5 };
 const OGLAttrib OGLConstants::BINORMAL = { "vBinormal", 6 };
+const OGLAttrib OGLConstants::DRAW_ID = { "vDrawID", 7 };
 
 const OGLFragData OGLConstants::FRAG_COLOR = { "fragColor", 0 };
 
 const OGLUniformBlock OGLConstants::LIGHT = { "LightBlock", 0 };
 const OGLUniformBlock OGLConstants::MATERIAL = { "MaterialBlock", 1 };
+const OGLUniformBlock OGLConstants::GEAR = { "GearBlock", 2 };
 
 const char* OGLConstants::MODEL_VIEW_MATRIX = "modelViewMatrix";
 const char* OGLConstants::PROJECTION_MATRIX = "projectionMatrix";
@@ -51,9 +53,12 @@ const char* OGLConstants::COLOR_MATRIX = "colorMatrix";
 const char* OGLConstants::N_LIGHTS = "nLights";
 const char* OGLConstants::GLOBAL_AMBIENT_LIGHT = "globalAmbientLight";
 const char* OGLConstants::TIME = "time";
+const char* OGLConstants::DRAW_DATA_ENABLED = "isDrawDataEnabled";
 
 const OGLSampler OGLConstants::TEXTURE0 = { "texture0", 0 };
 const OGLSampler OGLConstants::TEXTURE1 = { "texture1", 1 };
+const OGLSampler OGLConstants::DRAW_DATA = { "drawData", 7 };
+const OGLSampler OGLConstants::INSTANCE_DATA = { "instanceData", 6 };
 
 
 void OGLConstants::bindAttribFragDataLocations(GLuint program) {
@@ -64,6 +69,7 @@ void OGLConstants::bindAttribFragDataLocations(GLuint program) {
   glBindAttribLocation(program, TEX_COORD_1.location, TEX_COORD_1.name);
   glBindAttribLocation(program, TANGENT.location, TANGENT.name);
   glBindAttribLocation(program, BINORMAL.location, BINORMAL.name);
+  glBindAttribLocation(program, DRAW_ID.location, DRAW_ID.name);
 
   glBindFragDataLocation(program, FRAG_COLOR.location, FRAG_COLOR.name);
 
@@ -80,6 +86,10 @@ void OGLConstants::bindUniformBlocks(GLuint program) {
   if (materialIndex != GL_INVALID_INDEX) {
     glUniformBlockBinding(program, materialIndex, MATERIAL.bindingPoint);
   }
+  GLuint gearIndex = glGetUniformBlockIndex(program, GEAR.name);
+  if (gearIndex != GL_INVALID_INDEX) {
+    glUniformBlockBinding(program, gearIndex, GEAR.bindingPoint);
+  }
 
   assert(!checkGLError());
 }
@@ -90,6 +100,8 @@ void OGLConstants::bindSamplers(GLuint program) {
   SCG_SAVE_AND_SWITCH_PROGRAM(program, programOld);
   glUniform1i(glGetUniformLocation(program, TEXTURE0.name), TEXTURE0.texUnit);
   glUniform1i(glGetUniformLocation(program, TEXTURE1.name), TEXTURE1.texUnit);
+  glUniform1i(glGetUniformLocation(program, DRAW_DATA.name), DRAW_DATA.texUnit);
+  glUniform1i(glGetUniformLocation(program, INSTANCE_DATA.name), INSTANCE_DATA.texUnit);
   SCG_RESTORE_PROGRAM(program, programOld);
 
   assert(!checkGLError());
@@ -151,10 +151,15 @@ SCG_DECLARE_CLASS(Controller);
 SCG_DECLARE_CLASS(ColorCore);
 SCG_DECLARE_CLASS(Core);
 SCG_DECLARE_CLASS(CubeMapCore);
+SCG_DECLARE_CLASS(DrawBatcher);
+SCG_DECLARE_CLASS(GearCore);
+SCG_DECLARE_CLASS(GeometryArena);
 SCG_DECLARE_CLASS(GeometryCore);
 SCG_DECLARE_CLASS(GeometryCoreFactory);
+SCG_DECLARE_CLASS(GeometryCoreFuture);
 SCG_DECLARE_CLASS(Group);
 SCG_DECLARE_CLASS(InfoTraverser);
+SCG_DECLARE_CLASS(InstancedShape);
 SCG_DECLARE_CLASS(KeyboardController);
 SCG_DECLARE_CLASS(Leaf);
 SCG_DECLARE_CLASS(Light);
@@ -168,10 +173,13 @@ SCG_DECLARE_CLASS(PreTraverser);
 SCG_DECLARE_CLASS(Renderer);
 SCG_DECLARE_CLASS(RenderState);
 SCG_DECLARE_CLASS(RenderTraverser);
+SCG_DECLARE_CLASS(SceneArena);
+SCG_DECLARE_CLASS(SceneCompiler);
 SCG_DECLARE_CLASS(ShaderCore);
 SCG_DECLARE_CLASS(ShaderCoreFactory);
 SCG_DECLARE_CLASS(Shape);
 SCG_DECLARE_CLASS(StandardRenderer);
+SCG_DECLARE_CLASS(StreamBuffer);
 SCG_DECLARE_CLASS(TextureCore);
 SCG_DECLARE_CLASS(Texture2DCore);
 SCG_DECLARE_CLASS(TransformAnimation);
@@ -292,6 +300,7 @@ public:
   static const OGLAttrib TEX_COORD_1;
   static const OGLAttrib TANGENT;
   static const OGLAttrib BINORMAL;
+  static const OGLAttrib DRAW_ID;
 
   // fragment data names and locations, defined in internals.cpp
   static const OGLFragData FRAG_COLOR;
@@ -299,6 +308,7 @@ public:
   // uniform block names and indices, defined in internals.cpp
   static const OGLUniformBlock LIGHT;
   static const OGLUniformBlock MATERIAL;
+  static const OGLUniformBlock GEAR;
 
   // uniform names
   static const char* MODEL_VIEW_MATRIX;
@@ -310,10 +320,13 @@ public:
   static const char* N_LIGHTS;
   static const char* GLOBAL_AMBIENT_LIGHT;
   static const char* TIME;
+  static const char* DRAW_DATA_ENABLED;
 
   // sampler names and texture units
   static const OGLSampler TEXTURE0;
   static const OGLSampler TEXTURE1;
+  static const OGLSampler DRAW_DATA;
+  static const OGLSampler INSTANCE_DATA;
 
   // parameters
   static const int MAX_NUMBER_OF_LIGHTS = 10;
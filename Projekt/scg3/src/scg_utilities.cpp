@@ -21,6 +21,7 @@
  * limitations under the License.
  */
 
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <map>
@@ -55,6 +56,28 @@ bool isGLContextActive() {
 }
 
 
+bool isGLVersionSupported(GLint major, GLint minor) {
+  GLint contextMajor = 0;
+  GLint contextMinor = 0;
+  glGetIntegerv(GL_MAJOR_VERSION, &contextMajor);
+  glGetIntegerv(GL_MINOR_VERSION, &contextMinor);
+  return contextMajor > major || (contextMajor == major && contextMinor >= minor);
+}
+
+
+bool isGLExtensionSupported(const char* extension) {
+  GLint nExtensions = 0;
+  glGetIntegerv(GL_NUM_EXTENSIONS, &nExtensions);
+  for (GLint i = 0; i < nExtensions; ++i) {
+    const char* name = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i));
+    if (name && std::strcmp(name, extension) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+
 void getCursorPosPixels(GLFWwindow* window, double& xPixels, double& yPixels) {
   // get window size (screen coords) and framebuffer size (pixels)
   int wScreen, hScreen, wPixels, hPixels;
@@ -60,6 +60,18 @@ int checkGLError();
 bool isGLContextActive();
 
 
+/**
+ * \brief Check if the current OpenGL context supports at least the given version.
+ *
+ * The context is queried directly, since GLEW flags depend on the requested context version.
+ */
+bool isGLVersionSupported(GLint major, GLint minor);
+
+/**
+ * \brief Check if the current OpenGL context supports the given extension.
+ */
+bool isGLExtensionSupported(const char* extension);
+
 /**
  * \brief Get cursor (mouse pointer) position in pixels, as opposed to screen coordinates.
  *
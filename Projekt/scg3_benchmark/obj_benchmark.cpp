@@ -0,0 +1,225 @@
+/**
+ * \file obj_benchmark.cpp
+ * \brief Throughput benchmark of the OBJ parser of GeometryCoreFactory.
+ *
+ * Checks the number parsers on edge cases, then parses the bundled OBJ models
+ * repeatedly and reports the throughput (MB/s) and the time per file (ms).
+ * Only the parser is measured, hence no OpenGL context is required.
+ *
+ * Usage: scg3_obj_benchmark [nRuns] [file.obj ...]
+ *
+ * \author Projektgruppe "Zahnradapparatus"
+ */
+
+/*
+ * Copyright 2026 Projektgruppe "Zahnradapparatus"
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <scg3.h>
+
+using namespace scg;
+
+/**
+ * \brief Geometry core factory exposing the OBJ parser for benchmarking.
+ */
+class OBJParserBenchmark : public GeometryCoreFactory {
+
+public:
+
+	OBJParserBenchmark(const std::string& filePath)
+			: GeometryCoreFactory(filePath) {
+	}
+
+	/**
+	 * Parse OBJ file without creating a geometry core.
+	 *
+	 * \return number of faces
+	 */
+	int parseFile(const std::string& fileName) const {
+		OBJModel model;
+		if (loadOBJFile_(fileName, model) != 0) {
+			throw std::runtime_error("Cannot parse OBJ file " + fileName);
+		}
+		return model.getNFaces();
+	}
+
+	static bool parseFloat(const std::string& text, float& value) {
+		const char* p = text.c_str();
+		return parseFloat_(p, p + text.size(), value);
+	}
+
+	static bool parseInt(const std::string& text, int& value) {
+		const char* p = text.c_str();
+		return parseInt_(p, p + text.size(), value);
+	}
+
+};
+
+/**
+ * \brief Check the number parsers on edge cases.
+ *
+ * \return number of failed checks
+ */
+int checkParsers();
+
+/**
+ * \brief Parse the given OBJ files nRuns times each and print throughput statistics.
+ */
+void runBenchmark(const std::vector<std::string>& fileNames, int nRuns);
+
+/**
+ * \brief The main function.
+ */
+int main(int argc, char* argv[]) {
+
+	int result = 0;
+
+	try {
+		int nRuns = (argc > 1) ? std::max(1, std::atoi(argv[1])) : 20;
+		std::vector<std::string> fileNames;
+		for (int i = 2; i < argc; ++i) {
+			fileNames.push_back(argv[i]);
+		}
+		if (fileNames.empty()) {
+			fileNames = { "cessna.obj", "icosahedron.obj", "gear.obj", "gear_center.obj",
+					"spot.obj", "broccoli.obj", "bulb.obj", "lamp1.obj", "Gitter.obj" };
+		}
+
+		if (checkParsers() > 0) {
+			result = 1;
+		}
+		runBenchmark(fileNames, nRuns);
+	} catch (const std::exception& exc) {
+		std::cerr << std::endl << "Exception: " << exc.what() << std::endl;
+		result = 1;
+	}
+	return result;
+}
+
+
+int checkParsers() {
+
+	struct FloatCase {
+		const char* text;
+		float expected;
+	};
+	const FloatCase floatCases[] = {
+			{ "0", 0.f }, { "-1.5", -1.5f }, { "+2.25e2", 225.f }, { "1e-3", 1e-3f },
+			{ "0e-30", 0.f }, { "0.0e-400", 0.f }, { "1e-400", 0.f }, { "-1e-400", -0.f },
+			{ "123456789012345678901234567890", 1.23456789e29f },
+			{ "1e400", std::numeric_limits<float>::infinity() } };
+
+	int nFailed = 0;
+	for (const auto& fc : floatCases) {
+		float value = -42.f;
+		bool isOk = OBJParserBenchmark::parseFloat(fc.text, value);
+		if (std::isinf(fc.expected)) {
+			isOk = isOk && std::isinf(value);
+		}
+		else {
+			isOk = isOk && std::fabs(value - fc.expected) <= 1e-6f * std::fabs(fc.expected);
+		}
+		if (!isOk) {
+			std::cerr << "parseFloat_(\"" << fc.text << "\") = " << value
+					<< ", expected " << fc.expected << std::endl;
+			++nFailed;
+		}
+	}
+
+	struct IntCase {
+		const char* text;
+		int expected;
+	};
+	const IntCase intCases[] = {
+			{ "0", 0 }, { "42", 42 }, { "-7", -7 },
+			{ "2147483647", std::numeric_limits<int>::max() },
+			{ "2147483648", std::numeric_limits<int>::max() },
+			{ "99999999999999999999", std::numeric_limits<int>::max() },
+			{ "-99999999999999999999", -std::numeric_limits<int>::max() } };
+
+	for (const auto& ic : intCases) {
+		int value = -42;
+		if (!OBJParserBenchmark::parseInt(ic.text, value) || value != ic.expected) {
+			std::cerr << "parseInt_(\"" << ic.text << "\") = " << value
+					<< ", expected " << ic.expected << std::endl;
+			++nFailed;
+		}
+	}
+
+	std::cout << "Parser checks: " << (nFailed == 0 ? "passed" : "FAILED") << std::endl;
+	return nFailed;
+}
+
+
+void runBenchmark(const std::vector<std::string>& fileNames, int nRuns) {
+
+	typedef std::chrono::steady_clock Clock;
+	const std::string filePath = "../scg3/models;../../scg3/models;../scg3_gears/obj;"
+			"../../scg3_gears/obj;..;../..";
+	OBJParserBenchmark factory(filePath);
+	std::vector<std::string> filePaths;
+	splitFilePath(filePath, filePaths);
+
+	std::cout << std::endl << std::left << std::setw(20) << "file"
+			<< std::right << std::setw(12) << "size (kB)" << std::setw(10) << "faces"
+			<< std::setw(12) << "ms/file" << std::setw(12) << "MB/s" << std::endl;
+
+	double totalBytes = 0., totalSeconds = 0.;
+	for (const auto& fileName : fileNames) {
+		std::string fullFileName = getFullFileName(filePaths, fileName);
+		if (fullFileName.empty()) {
+			std::cerr << fileName << ": not found, skipped" << std::endl;
+			continue;
+		}
+		MappedFile file;
+		if (!file.open(fullFileName)) {
+			std::cerr << fileName << ": cannot be opened, skipped" << std::endl;
+			continue;
+		}
+		const double bytes = static_cast<double>(file.getSize());
+		file.close();
+
+		// warm up page cache, then measure
+		int nFaces = factory.parseFile(fileName);
+		auto start = Clock::now();
+		for (int i = 0; i < nRuns; ++i) {
+			nFaces = factory.parseFile(fileName);
+		}
+		const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+		totalBytes += bytes * nRuns;
+		totalSeconds += seconds;
+
+		std::cout << std::left << std::setw(20) << fileName << std::right << std::fixed
+				<< std::setw(12) << std::setprecision(1) << bytes / 1024.
+				<< std::setw(10) << nFaces
+				<< std::setw(12) << std::setprecision(3) << 1000. * seconds / nRuns
+				<< std::setw(12) << std::setprecision(1) << bytes * nRuns / (1024. * 1024.) / seconds
+				<< std::endl;
+	}
+	if (totalSeconds > 0.) {
+		std::cout << std::left << std::setw(20) << "total" << std::right << std::setw(46)
+				<< std::setprecision(1) << totalBytes / (1024. * 1024.) / totalSeconds << std::endl;
+	}
+}
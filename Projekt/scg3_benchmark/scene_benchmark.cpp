@@ -0,0 +1,134 @@
+/**
+ * \file scene_benchmark.cpp
+ * \brief Benchmark of building, traversing, and destroying large scene graphs.
+ *
+ * Three scenes of transformation nodes are measured:
+ * - flat: one group with nNodes children
+ * - deep: a chain of nNodes nested transformations
+ * - very deep: a chain of nDeepNodes nested transformations (stack safety)
+ *
+ * The scenes are traversed by a PreTraverser, which applies all transformations.
+ * No OpenGL context is required.
+ *
+ * Usage: scg3_scene_benchmark [nNodes] [nDeepNodes]
+ *
+ * \author Projektgruppe "Zahnradapparatus"
+ */
+
+/*
+ * Copyright 2026 Projektgruppe "Zahnradapparatus"
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <scg3.h>
+
+using namespace scg;
+
+/**
+ * \brief Build a group with nNodes transformation children.
+ */
+GroupSP buildFlatScene(int nNodes);
+
+/**
+ * \brief Build a chain of nNodes nested transformations below a group.
+ */
+GroupSP buildDeepScene(int nNodes);
+
+/**
+ * \brief Build, traverse, and destroy a scene, print the times.
+ */
+void runBenchmark(const std::string& name, int nNodes, GroupSP (*buildScene)(int));
+
+/**
+ * \brief The main function.
+ */
+int main(int argc, char* argv[]) {
+
+	int result = 0;
+
+	try {
+		int nNodes = (argc > 1) ? std::max(1, std::atoi(argv[1])) : 100000;
+		int nDeepNodes = (argc > 2) ? std::max(1, std::atoi(argv[2])) : 1000000;
+
+		std::cout << std::left << std::setw(12) << "scene" << std::right << std::setw(10) << "nodes"
+				<< std::setw(14) << "build (ms)" << std::setw(16) << "traverse (ms)"
+				<< std::setw(14) << "destroy (ms)" << std::endl;
+		runBenchmark("flat", nNodes, buildFlatScene);
+		runBenchmark("deep", nNodes, buildDeepScene);
+		runBenchmark("very deep", nDeepNodes, buildDeepScene);
+	} catch (const std::exception& exc) {
+		std::cerr << std::endl << "Exception: " << exc.what() << std::endl;
+		result = 1;
+	}
+	return result;
+}
+
+
+GroupSP buildFlatScene(int nNodes) {
+	auto root = Group::create();
+	for (int i = 0; i < nNodes; ++i) {
+		auto trans = Transformation::create();
+		trans->translate(glm::vec3(0.001f * i, 0.f, 0.f));
+		root->addChild(trans);
+	}
+	return root;
+}
+
+
+GroupSP buildDeepScene(int nNodes) {
+	auto root = Group::create();
+	Composite* parent = root.get();
+	for (int i = 0; i < nNodes; ++i) {
+		auto trans = Transformation::create();
+		trans->translate(glm::vec3(0.001f, 0.f, 0.f));
+		parent->addChild(trans);
+		parent = trans.get();
+	}
+	return root;
+}
+
+
+void runBenchmark(const std::string& name, int nNodes, GroupSP (*buildScene)(int)) {
+
+	typedef std::chrono::steady_clock Clock;
+	const int nTraversals = 10;
+
+	auto start = Clock::now();
+	GroupSP root = buildScene(nNodes);
+	const double buildTime = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+	RenderState renderState;
+	PreTraverser traverser(&renderState);
+	start = Clock::now();
+	for (int i = 0; i < nTraversals; ++i) {
+		root->traverse(&traverser);
+	}
+	const double traverseTime = std::chrono::duration<double, std::milli>(Clock::now() - start).count()
+			/ nTraversals;
+
+	start = Clock::now();
+	root->destroy();
+	root.reset();
+	const double destroyTime = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+	std::cout << std::left << std::setw(12) << name << std::right << std::setw(10) << nNodes
+			<< std::fixed << std::setprecision(1) << std::setw(14) << buildTime
+			<< std::setw(16) << traverseTime << std::setw(14) << destroyTime << std::endl;
+}
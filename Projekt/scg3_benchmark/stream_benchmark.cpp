@@ -0,0 +1,229 @@
+/**
+ * \file stream_benchmark.cpp
+ * \brief Benchmark of streamed vertex data, rendering a deforming mesh.
+ *
+ * A grid of nGrid x nGrid vertices is deformed by a travelling wave, and all vertices
+ * are rewritten every frame via GeometryCore::setStreamVertexData(). After a number
+ * of frames, the average frame time and the time spent writing vertices are printed.
+ *
+ * Usage: scg3_stream_benchmark [map|update] [nGrid] [nFrames]
+ * - map: write vertices directly into the stream buffer (mapVertexData())
+ * - update: write vertices into client memory and copy them (updateVertexData())
+ *
+ * Requires C++11 and OpenGL 3.2 (or later versions).
+ *
+ * \author Projektgruppe "Zahnradapparatus"
+ */
+
+/*
+ * Copyright 2026 Projektgruppe "Zahnradapparatus"
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <scg3.h>
+
+using namespace scg;
+
+/**
+ * \brief Animation that rewrites the vertices of a grid every frame, deformed by a wave.
+ */
+class DeformAnimation: public Animation {
+
+public:
+
+	/**
+	 * Constructor, allocates the stream buffer of the geometry core.
+	 *
+	 * \param core geometry core whose element indices have already been set
+	 * \param nGrid number of vertices per grid row and column
+	 * \param nFrames number of frames to be measured (after warm-up)
+	 * \param isMapped true to write into the mapped stream buffer, false to copy
+	 *   from client memory by updateVertexData()
+	 */
+	DeformAnimation(GeometryCoreSP core, int nGrid, int nFrames, bool isMapped)
+			: core_(core), nGrid_(nGrid), nFrames_(nFrames), isMapped_(isMapped),
+			  frame_(0), startTime_(0.), writeTime_(0.) {
+		layout_.addAttribute(OGLConstants::VERTEX.location, 3)
+				.addAttribute(OGLConstants::NORMAL.location, 3);
+		const GLsizei nVertices = nGrid * nGrid;
+		core_->setStreamVertexData(layout_, nVertices);
+		core_->setBoundingBox(glm::vec3(-1.f, -AMPLITUDE, -1.f), glm::vec3(1.f, AMPLITUDE, 1.f));
+		if (!isMapped_) {
+			clientData_.resize(static_cast<size_t>(nVertices) * layout_.getStride());
+		}
+	}
+
+	virtual void update(double currTime) {
+		Animation::update(currTime);
+
+		// start measurement after warm-up, stop after nFrames
+		if (frame_ == N_WARMUP_FRAMES) {
+			startTime_ = glfwGetTime();
+			writeTime_ = 0.;
+		}
+		else if (frame_ == N_WARMUP_FRAMES + nFrames_) {
+			glFinish();
+			double totalTime = glfwGetTime() - startTime_;
+			std::cout << (isMapped_ ? "mapVertexData" : "updateVertexData") << ": "
+					<< nGrid_ * nGrid_ << " vertices, "
+					<< nGrid_ * nGrid_ * layout_.getStride() / 1024 << " KB per frame" << std::endl
+					<< "  frame time:  " << 1000. * totalTime / nFrames_ << " ms" << std::endl
+					<< "  write time:  " << 1000. * writeTime_ / nFrames_ << " ms" << std::endl;
+			glfwSetWindowShouldClose(glfwGetCurrentContext(), GL_TRUE);
+		}
+		++frame_;
+
+		double writeStart = glfwGetTime();
+		if (isMapped_) {
+			writeVertices_(static_cast<GLubyte*>(core_->mapVertexData()), currTime);
+			core_->unmapVertexData();
+		}
+		else {
+			writeVertices_(clientData_.data(), currTime);
+			core_->updateVertexData(clientData_.data(), static_cast<GLsizeiptr>(clientData_.size()));
+		}
+		writeTime_ += glfwGetTime() - writeStart;
+	}
+
+protected:
+
+	/**
+	 * Write positions and normals of the grid in [-1, 1]^2 (xz plane), displaced in y
+	 * by a radial wave.
+	 */
+	void writeVertices_(GLubyte* data, double time) const {
+		const GLsizei stride = layout_.getStride();
+		const GLfloat phase = static_cast<GLfloat>(time) * SPEED;
+		const GLfloat step = 2.f / static_cast<GLfloat>(nGrid_ - 1);
+		for (int j = 0; j < nGrid_; ++j) {
+			const GLfloat z = -1.f + j * step;
+			for (int i = 0; i < nGrid_; ++i, data += stride) {
+				const GLfloat x = -1.f + i * step;
+				const GLfloat r = std::sqrt(x * x + z * z);
+				const GLfloat y = AMPLITUDE * std::sin(WAVE_NUMBER * r - phase);
+
+				// normal from partial derivatives of y = f(r)
+				const GLfloat dydr = AMPLITUDE * WAVE_NUMBER * std::cos(WAVE_NUMBER * r - phase);
+				const GLfloat dx = (r > 0.f) ? dydr * x / r : 0.f;
+				const GLfloat dz = (r > 0.f) ? dydr * z / r : 0.f;
+				const glm::vec3 normal = glm::normalize(glm::vec3(-dx, 1.f, -dz));
+
+				GLfloat* vertex = reinterpret_cast<GLfloat*>(data);
+				vertex[0] = x;
+				vertex[1] = y;
+				vertex[2] = z;
+				vertex[3] = normal.x;
+				vertex[4] = normal.y;
+				vertex[5] = normal.z;
+			}
+		}
+	}
+
+protected:
+
+	static const int N_WARMUP_FRAMES = 10;
+	static constexpr GLfloat AMPLITUDE = 0.08f;
+	static constexpr GLfloat WAVE_NUMBER = 12.f;
+	static constexpr GLfloat SPEED = 4.f;
+
+	GeometryCoreSP core_;
+	VertexLayout layout_;
+	int nGrid_;
+	int nFrames_;
+	bool isMapped_;
+	int frame_;
+	double startTime_;
+	double writeTime_;
+	std::vector<GLubyte> clientData_;
+
+};
+
+/**
+ * \brief Create a geometry core for a grid of nGrid x nGrid vertices, with element
+ *   indices but without vertex data.
+ */
+GeometryCoreSP createGridCore(int nGrid);
+
+/**
+ * \brief The main function.
+ */
+int main(int argc, char* argv[]) {
+
+	int result = 0;
+
+	try {
+		bool isMapped = (argc <= 1 || std::strcmp(argv[1], "update") != 0);
+		int nGrid = (argc > 2) ? std::max(2, std::atoi(argv[2])) : 256;
+		int nFrames = (argc > 3) ? std::max(1, std::atoi(argv[3])) : 300;
+
+		// create viewer and renderer
+		auto viewer = Viewer::create();
+		CameraSP camera;
+		GroupSP scene;
+		LightSP light;
+		viewer->initSimpleRenderer(camera, scene, light)
+				->setWindowTitle("s c g 3   s t r e a m   b e n c h m a r k");
+		camera->translate(glm::vec3(0.f, 0.f, 3.f));
+
+		// deforming grid, rewritten by the animation before each frame
+		auto gridCore = createGridCore(nGrid);
+		auto deformAnim = std::make_shared<DeformAnimation>(gridCore, nGrid, nFrames, isMapped);
+		viewer->addAnimation(deformAnim);
+
+		auto matBlue = MaterialCore::create();
+		matBlue->setAmbientAndDiffuse(glm::vec4(0.5f, 0.5f, 1.f, 1.f))
+				->setSpecular(glm::vec4(0.8f, 0.8f, 0.8f, 1.f))
+				->setShininess(20.f)
+				->init();
+		auto grid = Shape::create();
+		grid->addCore(matBlue)->addCore(gridCore);
+		auto gridTrans = Transformation::create();
+		gridTrans->rotate(60.f, glm::vec3(1.f, 0.f, 0.f));
+		light->addChild(gridTrans);
+		gridTrans->addChild(grid);
+
+		viewer->startAnimations()->startMainLoop();
+	} catch (const std::exception& exc) {
+		std::cerr << std::endl << "Exception: " << exc.what() << std::endl;
+		result = 1;
+	}
+	return result;
+}
+
+
+GeometryCoreSP createGridCore(int nGrid) {
+
+	// two triangles per grid cell
+	std::vector<GLuint> indices;
+	indices.reserve(6 * static_cast<size_t>(nGrid - 1) * (nGrid - 1));
+	for (int j = 0; j < nGrid - 1; ++j) {
+		for (int i = 0; i < nGrid - 1; ++i) {
+			GLuint v00 = j * nGrid + i, v10 = v00 + 1, v01 = v00 + nGrid, v11 = v01 + 1;
+			indices.insert(indices.end(), { v00, v01, v10, v10, v01, v11 });
+		}
+	}
+
+	auto core = GeometryCore::create(GL_TRIANGLES, DrawMode::ELEMENTS);
+	core->setElementIndexData(indices.data(),
+			static_cast<GLsizeiptr>(indices.size() * sizeof(GLuint)), GL_STATIC_DRAW);
+	return core;
+}
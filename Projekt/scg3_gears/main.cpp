@@ -118,6 +118,13 @@ void createGearScene(ViewerSP viewer, CameraSP camera, GroupSP& scene) {
 									GL_FRAGMENT_SHADER), ShaderFile(
 									"texture2d_modulate.glsl",
 									GL_FRAGMENT_SHADER) });
+
+	// Phong shader for procedural gears (cf. GearCore)
+	auto shaderGear = shaderFactory.createShaderFromSourceFiles(
+			{ ShaderFile("gear_vert.glsl", GL_VERTEX_SHADER), ShaderFile(
+					"phong_frag.glsl", GL_FRAGMENT_SHADER), ShaderFile(
+					"blinn_phong_lighting.glsl", GL_FRAGMENT_SHADER),
+					ShaderFile("texture_none.glsl", GL_FRAGMENT_SHADER) });
 #else
   // Phong shader
   std::vector<ShaderFile> shaderFiles;
@@ -134,6 +141,14 @@ void createGearScene(ViewerSP viewer, CameraSP camera, GroupSP& scene) {
   shaderFiles.push_back(ShaderFile("blinn_phong_lighting.glsl", GL_FRAGMENT_SHADER));
   shaderFiles.push_back(ShaderFile("texture2d_modulate.glsl", GL_FRAGMENT_SHADER));
   auto shaderPhongTex = shaderFactory.createShaderFromSourceFiles(shaderFiles);
+
+  // Phong shader for procedural gears (cf. GearCore)
+  shaderFiles.clear();
+  shaderFiles.push_back(ShaderFile("gear_vert.glsl", GL_VERTEX_SHADER));
+  shaderFiles.push_back(ShaderFile("phong_frag.glsl", GL_FRAGMENT_SHADER));
+  shaderFiles.push_back(ShaderFile("blinn_phong_lighting.glsl", GL_FRAGMENT_SHADER));
+  shaderFiles.push_back(ShaderFile("texture_none.glsl", GL_FRAGMENT_SHADER));
+  auto shaderGear = shaderFactory.createShaderFromSourceFiles(shaderFiles);
 #endif
 
 	// camera controllers
@@ -324,15 +339,20 @@ void createGearScene(ViewerSP viewer, CameraSP camera, GroupSP& scene) {
 	 *
 	 *
 	 */
-	auto clockAxisCore = geometryFactory.createModelFromOBJFile("obj/clock/06_achse.obj");
-	auto clockGear1Core = geometryFactory.createModelFromOBJFile("obj/clock/00_Zahnrad_1.obj");
-	auto clockGear2Core = geometryFactory.createModelFromOBJFile("obj/clock/01_Zahnrad_2.obj");
-	auto clockGear3Core = geometryFactory.createModelFromOBJFile("obj/clock/02_Zahnrad_3.obj");
-	auto clockGear4Core = geometryFactory.createModelFromOBJFile("obj/clock/03_Zahnrad_4.obj");
-	auto clockHandSmallCore = geometryFactory.createModelFromOBJFile("obj/clock/04_Zeiger_klein.obj");
-	auto clockHandBigCore = geometryFactory.createModelFromOBJFile("obj/clock/05_Zeiger_gross.obj");
-	auto clockAxis2ndCore = geometryFactory.createModelFromOBJFile("obj/clock/07_achse_2.obj");
-	auto clockGear2ndCore = geometryFactory.createModelFromOBJFile("obj/clock/08_zahnrad_abseits.obj");
+	// levels of detail with 50%, 25%, and 10% of the triangles, selected by screen-space error
+	const GLfloat lodRatios[] = { 0.5f, 0.25f, 0.1f };
+	geometryFactory.setLODRatios(std::vector<GLfloat>(lodRatios, lodRatios + 3));
+	// packed vertex attributes, binormals are not used by the Phong shaders
+	geometryFactory.setVertexFormat(VertexFormat::PACKED_NO_BINORMALS);
+	auto clockAxisCore = geometryFactory.createModelFromOBJFileAsync("obj/clock/06_achse.obj")->getCore();
+	auto clockGear1Core = geometryFactory.createModelFromOBJFileAsync("obj/clock/00_Zahnrad_1.obj")->getCore();
+	auto clockGear2Core = geometryFactory.createModelFromOBJFileAsync("obj/clock/01_Zahnrad_2.obj")->getCore();
+	auto clockGear3Core = geometryFactory.createModelFromOBJFileAsync("obj/clock/02_Zahnrad_3.obj")->getCore();
+	auto clockGear4Core = geometryFactory.createModelFromOBJFileAsync("obj/clock/03_Zahnrad_4.obj")->getCore();
+	auto clockHandSmallCore = geometryFactory.createModelFromOBJFileAsync("obj/clock/04_Zeiger_klein.obj")->getCore();
+	auto clockHandBigCore = geometryFactory.createModelFromOBJFileAsync("obj/clock/05_Zeiger_gross.obj")->getCore();
+	auto clockAxis2ndCore = geometryFactory.createModelFromOBJFileAsync("obj/clock/07_achse_2.obj")->getCore();
+	auto clockGear2ndCore = geometryFactory.createModelFromOBJFileAsync("obj/clock/08_zahnrad_abseits.obj")->getCore();
 
 
 	auto clockAxis = Shape::create(); clockAxis->addCore(matGold)->addCore(clockAxisCore);
@@ -389,7 +409,7 @@ void createGearScene(ViewerSP viewer, CameraSP camera, GroupSP& scene) {
 
 
 
-	auto spotCore = geometryFactory.createModelFromOBJFile("obj/spot.obj");
+	auto spotCore = geometryFactory.createModelFromOBJFileAsync("obj/spot.obj")->getCore();
 	auto spot = Shape::create();
 	spot->addCore(matGrey)->addCore(spotCore);
 	auto spotTrans = Transformation::create();
@@ -399,7 +419,7 @@ void createGearScene(ViewerSP viewer, CameraSP camera, GroupSP& scene) {
 	spotTrans->rotate(180.0f, glm::vec3(0.f, 1.f, 0.f));
 */	spotTrans->scale(glm::vec3(0.2f, 0.2f, 0.2f));
 
-	auto stabCore = geometryFactory.createModelFromOBJFile("obj/gear_center.obj");
+	auto stabCore = geometryFactory.createModelFromOBJFileAsync("obj/gear_center.obj")->getCore();
 	auto stab = Shape::create();
 	stab->addCore(matGold)->addCore(stabCore);
 	auto stabTrans = Transformation::create();
@@ -407,9 +427,11 @@ void createGearScene(ViewerSP viewer, CameraSP camera, GroupSP& scene) {
 	stabTrans->rotate(90.f, glm::vec3(1.f, 0.f, 0.f));
 
 
-	auto gearCore = geometryFactory.createModelFromOBJFile("obj/gear.obj");
+	// procedural gear, generated by the vertex shader without vertex buffers (cf. GearCore),
+	// 16 teeth meshing at the distance of both axes
+	auto gearCore = GearCore::create(16, 0.08625f, 20.f, 0.27f, 0.246f);
 	auto gear = Shape::create();
-	gear->addCore(matMessing)->addCore(gearCore);
+	gear->addCore(shaderGear)->addCore(matMessing)->addCore(gearCore);
 	auto gearTrans = Transformation::create();
 	gearTrans->translate(glm::vec3(-0.45f, 0.75f, -4.7f));
 	gearTrans->rotate(90.f, glm::vec3(1.f, 0.f, 0.f));
@@ -424,13 +446,14 @@ void createGearScene(ViewerSP viewer, CameraSP camera, GroupSP& scene) {
 			});
 	viewer->addAnimation(gearAnim);
 	// add transformation (translation) to be applied before animation
+	// (gear axis is z, animation axis is y)
 	auto gearAnimTrans = Transformation::create();
-	gearAnimTrans->translate(glm::vec3(0.0f, 0.f, 0.f));
+	gearAnimTrans->rotate(-90.f, glm::vec3(1.f, 0.f, 0.f));
 
 
 
 
-	auto stab2Core = geometryFactory.createModelFromOBJFile("obj/gear_center.obj");
+	auto stab2Core = geometryFactory.createModelFromOBJFileAsync("obj/gear_center.obj")->getCore();
 	auto stab2 = Shape::create();
 	stab2->addCore(matMessing)->addCore(stab2Core);
 	auto stab2Trans = Transformation::create();
@@ -439,9 +462,8 @@ void createGearScene(ViewerSP viewer, CameraSP camera, GroupSP& scene) {
 
 
 	// Create Zahnrad 2
-	auto gear2Core = geometryFactory.createModelFromOBJFile("obj/gear.obj");
 	auto gear2 = Shape::create();
-	gear2->addCore(matGold)->addCore(gear2Core);
+	gear2->addCore(shaderGear)->addCore(matGold)->addCore(gearCore);
 	auto gear2Trans = Transformation::create();
 	gear2Trans->translate(glm::vec3(0.93f, 0.75f, -4.7f));
 	gear2Trans->rotate(90.f, glm::vec3(1.f, 0.f, 0.f));
@@ -457,13 +479,14 @@ void createGearScene(ViewerSP viewer, CameraSP camera, GroupSP& scene) {
 			});
 	viewer->addAnimation(gear2Anim);
 	// add transformation (translation) to be applied before animation
+	// (gear axis is z, rotated by half a tooth to mesh with the first gear)
 	auto gear2AnimTrans = Transformation::create();
-	gear2AnimTrans->translate(glm::vec3(0.0f, 0.f, 0.f));
+	gear2AnimTrans->rotate(-90.f, glm::vec3(1.f, 0.f, 0.f))
+			->rotate(180.f / 16.f, glm::vec3(0.f, 0.f, 1.f));
 
 	//Create Zahnrad auf dem Boden
-	auto gearFloorCore = geometryFactory.createModelFromOBJFile("obj/gear.obj");
 	auto gearFloor = Shape::create();
-	gearFloor->addCore(matChrom)->addCore(gearFloorCore);
+	gearFloor->addCore(shaderGear)->addCore(matChrom)->addCore(gearCore);
 	auto gearFloorTrans = Transformation::create();
 	gearFloorTrans->translate(glm::vec3(0.f, -0.4f, 0.f));
 	gearFloorTrans->scale(glm::vec3(1.5f, 1.5f, 1.5f));
@@ -479,9 +502,12 @@ void createGearScene(ViewerSP viewer, CameraSP camera, GroupSP& scene) {
 			});
 	viewer->addAnimation(gearFloorAnim);
 	// add transformation (translation) to be applied before animation
+	// (gear axis is z)
 	auto gearFloorAnimTrans = Transformation::create();
-	gearFloorAnimTrans->translate(glm::vec3(0.0f, 0.f, 0.f));
+	gearFloorAnimTrans->rotate(-90.f, glm::vec3(1.f, 0.f, 0.f));
 
+	// coarser sphere tessellations are drawn at larger distances
+	geometryFactory.setAdaptiveTessellationEnabled(true);
 	auto sphereCore = geometryFactory.createSphere(1.0f, 50, 50) ;
 	   auto sphere = Shape::create();
 	   sphere->addCore(matWhite)
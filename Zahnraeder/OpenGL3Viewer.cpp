@@ -180,8 +180,8 @@ void OpenGL3Viewer::initModels_() {
   // add models
   //models_.push_back(new(RGBCubeModel));
 	//models_.push_back(new(TetraederModel));
-	models_.push_back(new ZahnRadModel(0.5, 0.42, 0.1, 14.0, 16.0));
-	models_.push_back(new ZahnRadModel(0.9, 0.2, 0.1, 14.0, 16.0));
+	models_.push_back(new ZahnRadModel(12, 0.5 / 7.0, 20.0, 0.1, 0.1, 4));
+	models_.push_back(new ZahnRadModel(24, 0.07, 20.0, 0.1, 0.6, 4));
 }
 
 
@@ -5,11 +5,24 @@
 #include "Model.h"
 
 
+/*
+ * Involute spur gear in xy plane, extruded along z axis and centered at origin.
+ * The tooth profile is computed once and replicated for all teeth.
+ */
 class ZahnRadModel : public Model {
 
 public:
 
-  ZahnRadModel(double, double, double, double, double);
+  /*
+   * nTeeth: number of teeth (at least 3)
+   * module: pitch diameter divided by number of teeth
+   * pressureAngleDeg: pressure angle (degrees, usually 20)
+   * thickness: face width in z direction
+   * boreRadius: radius of central hole (0 for none, less than root radius)
+   * nFlankSegments: number of line segments per tooth flank
+   */
+  ZahnRadModel(int nTeeth, double module, double pressureAngleDeg, double thickness,
+      double boreRadius, int nFlankSegments);
 
   virtual ~ZahnRadModel();
 
@@ -17,7 +30,8 @@ public:
 
 protected:
 
-  void init_(double, double, double, double, double);
+  void init_(int nTeeth, double module, double pressureAngleDeg, double thickness,
+      double boreRadius, int nFlankSegments);
 
 };
 